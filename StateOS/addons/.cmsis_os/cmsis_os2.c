@@ -24,7 +24,7 @@
 
     @file    StateOS: cmsis_os2.c
     @author  Rajmund Szymanski
-    @date    08.06.2020
+    @date    18.10.2026
     @brief   CMSIS-RTOS2 API implementation for StateOS.
 
  ******************************************************************************
@@ -177,6 +177,11 @@ uint32_t osKernelGetSysTimerFreq (void)
 #endif
 }
 
+uint32_t osKernelGetLoad (void)
+{
+	return sys_getLoad();
+}
+
 /* -------------------------------------------------------------------------- */
 
 static void thread_handler (void)
@@ -246,7 +251,7 @@ osThreadId_t osThreadNew (osThreadFunc_t func, void *argument, const osThreadAtt
 			return NULL;
 	}
 
-	sys_lock();
+	sys_schedLock();
 	{
 		tsk_init(&thread->tsk, (attr == NULL) ? osPriorityNormal : attr->priority, thread_handler, stack_mem, stack_size);
 		if (attr == NULL || attr->cb_mem == NULL || attr->cb_size == 0U ) thread->tsk.hdr.obj.res = thread;
@@ -258,7 +263,7 @@ osThreadId_t osThreadNew (osThreadFunc_t func, void *argument, const osThreadAtt
 		thread->func = func;
 		thread->arg = argument;
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return thread;
 }
@@ -451,6 +456,16 @@ uint32_t osThreadGetStackSpace (osThreadId_t thread_id)
 	return (uint32_t) port_get_sp() - (uint32_t) thread->tsk.stack;
 }
 
+uint64_t osThreadGetRunTime (osThreadId_t thread_id)
+{
+	osThread_t *thread = thread_id;
+
+	if (thread_id == NULL)
+		return 0U;
+
+	return tsk_getRunTime(&thread->tsk);
+}
+
 uint32_t osThreadGetCount (void)
 {
 	tsk_t   *tsk;
@@ -467,7 +482,7 @@ uint32_t osThreadGetCount (void)
 		for (tsk = IDLE.hdr.next; tsk != &IDLE; tsk = tsk->hdr.next)
 			count++;
 
-		for (tmr = WAIT.hdr.next; tmr != &WAIT; tmr = tmr->hdr.next)
+		for (tmr = core_tmr_next(&WAIT); tmr != &WAIT; tmr = core_tmr_next(tmr))
 			if (tmr->hdr.id == ID_READY)
 				count++;
 	}
@@ -492,7 +507,7 @@ uint32_t osThreadEnumerate (osThreadId_t *thread_array, uint32_t array_items)
 		for (tsk = IDLE.hdr.next; (tsk != &IDLE) && (count < array_items); tsk = tsk->hdr.next)
 			thread_array[count++] = tsk;
 
-		for (tmr = WAIT.hdr.next; (tmr != &WAIT) && (count < array_items); tmr = tmr->hdr.next)
+		for (tmr = core_tmr_next(&WAIT); (tmr != &WAIT) && (count < array_items); tmr = core_tmr_next(tmr))
 			if (tmr->hdr.id == ID_READY)
 				thread_array[count++] = tmr;
 	}
@@ -612,7 +627,7 @@ osTimerId_t osTimerNew (osTimerFunc_t func, osTimerType_t type, void *argument,
 			return NULL;
 	}
 
-	sys_lock();
+	sys_schedLock();
 	{
 		tmr_init(&timer->tmr, timer_handler);
 		if (attr == NULL || attr->cb_mem == NULL || attr->cb_size == 0U) timer->tmr.hdr.obj.res = timer;
@@ -621,7 +636,7 @@ osTimerId_t osTimerNew (osTimerFunc_t func, osTimerType_t type, void *argument,
 		timer->func = func;
 		timer->arg = argument;
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return timer;
 }
@@ -715,14 +730,14 @@ osEventFlagsId_t osEventFlagsNew (const osEventFlagsAttr_t *attr)
 			return NULL;
 	}
 
-	sys_lock();
+	sys_schedLock();
 	{
 		flg_init(&ef->flg, 0);
 		if (attr == NULL || attr->cb_mem == NULL || attr->cb_size == 0U) ef->flg.obj.res = ef;
 		ef->flags = flags;
 		ef->name = (attr == NULL) ? NULL : attr->name;
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return ef;
 }
@@ -840,14 +855,14 @@ osMutexId_t osMutexNew (const osMutexAttr_t *attr)
 			return NULL;
 	}
 
-	sys_lock();
+	sys_schedLock();
 	{
 		mtx_init(&mutex->mtx, mutex_mode(flags), 0);
 		if (attr == NULL || attr->cb_mem == NULL || attr->cb_size == 0U) mutex->mtx.obj.res = mutex;
 		mutex->flags = flags;
 		mutex->name = (attr == NULL) ? NULL : attr->name;
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return mutex;
 }
@@ -946,14 +961,14 @@ osSemaphoreId_t osSemaphoreNew (uint32_t max_count, uint32_t initial_count, cons
 			return NULL;
 	}
 
-	sys_lock();
+	sys_schedLock();
 	{
 		sem_init(&semaphore->sem, initial_count, max_count);
 		if (attr == NULL || attr->cb_mem == NULL || attr->cb_size == 0U) semaphore->sem.obj.res = semaphore;
 		semaphore->flags = flags;
 		semaphore->name = (attr == NULL) ? NULL : attr->name;
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return semaphore;
 }
@@ -1074,7 +1089,7 @@ osMemoryPoolId_t osMemoryPoolNew (uint32_t block_count, uint32_t block_size, con
 			return NULL;
 	}
 
-	sys_lock();
+	sys_schedLock();
 	{
 		mem_init(&mp->mem, block_size, data, size);
 		if (attr == NULL || attr->cb_mem == NULL || attr->cb_size == 0U) mp->mem.lst.obj.res = mp;
@@ -1082,7 +1097,7 @@ osMemoryPoolId_t osMemoryPoolNew (uint32_t block_count, uint32_t block_size, con
 		mp->flags = flags;
 		mp->name = (attr == NULL) ? NULL : attr->name;
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return mp;
 }
@@ -1247,7 +1262,7 @@ osMessageQueueId_t osMessageQueueNew (uint32_t msg_count, uint32_t msg_size, con
 			return NULL;
 	}
 
-	sys_lock();
+	sys_schedLock();
 	{
 		box_init(&mq->box, msg_count, data, msg_size);
 		if (attr == NULL || attr->cb_mem == NULL || attr->cb_size == 0U) mq->box.obj.res = mq;
@@ -1255,7 +1270,7 @@ osMessageQueueId_t osMessageQueueNew (uint32_t msg_count, uint32_t msg_size, con
 		mq->flags = flags;
 		mq->name = (attr == NULL) ? NULL : attr->name;
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return mq;
 }
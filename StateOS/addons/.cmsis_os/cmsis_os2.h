@@ -360,6 +360,10 @@ uint32_t osKernelGetSysTimerCount (void);
 /// \return frequency of the system timer in hertz, i.e. timer ticks per second.
 uint32_t osKernelGetSysTimerFreq (void);
  
+/// Get the processor load since the previous call of the function (StateOS extension).
+/// \return processor load in percent, zero if the run time statistics are disabled.
+uint32_t osKernelGetLoad (void);
+ 
  
 //  ==== Thread Management Functions ====
  
@@ -394,6 +398,11 @@ uint32_t osThreadGetStackSize (osThreadId_t thread_id);
 /// \return remaining stack space in bytes.
 uint32_t osThreadGetStackSpace (osThreadId_t thread_id);
  
+/// Get run time of a thread (StateOS extension).
+/// \param[in]     thread_id     thread ID obtained by \ref osThreadNew or \ref osThreadGetId.
+/// \return run time in cycles of the cycle counter, zero if the run time statistics are disabled.
+uint64_t osThreadGetRunTime (osThreadId_t thread_id);
+ 
 /// Change priority of a thread.
 /// \param[in]     thread_id     thread ID obtained by \ref osThreadNew or \ref osThreadGetId.
 /// \param[in]     priority      new priority value for the thread function.
@@ -0,0 +1,482 @@
+/******************************************************************************
+
+    @file    StateOS: oscoro.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   C++20 coroutines for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOSCORO_H
+#define __STATEOSCORO_H
+
+#include <os.h>
+
+#if defined(__cplusplus) && (__cplusplus >= 202002) && defined(__cpp_impl_coroutine)
+
+#include <coroutine>
+
+/* -------------------------------------------------------------------------- */
+/*
+** Coroutines are stackless: all of them are executed by the stack of one task
+** running the executor. The executor waits for the objects awaited by all its
+** coroutines at once (sel_waitFor) with the nearest timeout, then takes the
+** objects on behalf of the coroutines and resumes them.
+** Requires c++20 compiler with coroutines support (e.g. -std=c++20).
+**
+** ExecutorT<8> exe;
+**
+** Coroutine blink( box_t &box )
+** {
+**     unsigned data;
+**     while (co_await ThisCoroutine::waitFor(box, &data, 100) == E_SUCCESS)
+**         co_await ThisCoroutine::sleepFor(data);
+** }
+**
+** exe.spawn(blink(box)); // use only before run or in the executor's coroutines
+** exe.run();             // use only in thread mode, returns when all the coroutines have finished
+*/
+/* -------------------------------------------------------------------------- */
+
+struct baseExecutor;
+
+/******************************************************************************
+ *
+ * Class             : Coroutine
+ *
+ * Description       : return type of the coroutine executed by the executor
+ *
+ * Note              : coroutine frame is allocated on the system heap
+ *                     invalid coroutine (not enough free memory) is ignored by the executor
+ *
+ ******************************************************************************/
+
+struct Coroutine
+{
+	struct promise_type
+	{
+		baseExecutor * exe  = nullptr; // executor of the coroutine
+		promise_type * next = nullptr; // next coroutine in the ready queue of the executor
+
+		static
+		Coroutine           get_return_object_on_allocation_failure( void ) { return Coroutine(nullptr); }
+		Coroutine           get_return_object  ( void )          { return Coroutine(this); }
+		std::suspend_always initial_suspend    ( void ) noexcept { return {}; }
+		std::suspend_always final_suspend      ( void ) noexcept { return {}; }
+		void                return_void        ( void )          {}
+		void                unhandled_exception( void )          {}
+	};
+
+	using handle = std::coroutine_handle<promise_type>;
+
+	explicit
+	Coroutine( promise_type *_co ): co_(_co) {}
+	Coroutine( Coroutine&& _other ): co_(_other.co_) { _other.co_ = nullptr; }
+	Coroutine( const Coroutine& ) = delete;
+	Coroutine& operator=( Coroutine&& ) = delete;
+	Coroutine& operator=( const Coroutine& ) = delete;
+
+	~Coroutine( void ) { if (co_ != nullptr) handle::from_promise(*co_).destroy(); }
+
+	promise_type *release( void ) { auto co = co_; co_ = nullptr; return co; }
+
+	private:
+	promise_type *co_;
+};
+
+/******************************************************************************
+ *
+ * Class             : baseAwaiter
+ *
+ * Description       : object awaited by the coroutine
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+struct baseAwaiter
+{
+	baseAwaiter( void *_obj, unsigned _type, unsigned _flags, void *_data, cnt_t _delay ):
+		sel   { _obj, _type, _flags },
+		data  { _data },
+		start { sys_time() },
+		delay { _delay },
+		event { E_TIMEOUT }
+	{}
+
+	sel_t    sel;   // select descriptor of the awaited object; sel.obj == nullptr: sleep only
+	void   * data;  // pointer to store the data taken from the object
+	cnt_t    start; // timepoint of the start of waiting
+	cnt_t    delay; // duration of waiting
+	unsigned event; // event value returned by co_await
+	Coroutine::promise_type *co = nullptr; // suspended coroutine
+	baseAwaiter *next = nullptr;           // next sleeping coroutine
+
+	// try to take the awaited object on behalf of the coroutine
+	unsigned take( void )
+	{
+		switch (sel.type)
+		{
+		case selSemaphore:    return sem_take(static_cast<sem_t *>(sel.obj));
+		case selMailboxQueue: return box_take(static_cast<box_t *>(sel.obj), data);
+		case selEventQueue:   return evq_take(static_cast<evq_t *>(sel.obj), static_cast<unsigned *>(data));
+		case selFlag:         return flg_take(static_cast<flg_t *>(sel.obj), sel.flags, flgAny) == 0 ? E_SUCCESS : E_TIMEOUT;
+		default:              return E_TIMEOUT;
+		}
+	}
+
+	bool expired( cnt_t _now ) { return delay != INFINITE && (cnt_t)(_now - start) >= delay; }
+
+	bool await_ready( void )
+	{
+		if (sel.obj != nullptr)
+			event = take();
+		return event != E_TIMEOUT || delay == IMMEDIATE;
+	}
+
+	void     await_suspend( Coroutine::handle _h );
+	unsigned await_resume ( void ) { return event; }
+};
+
+/******************************************************************************
+ *
+ * Class             : baseExecutor
+ *
+ * Description       : executor of the coroutines
+ *
+ * Constructor parameters
+ *   sel             : table of select descriptors of the awaited objects
+ *   awt             : table of coroutines awaiting the objects
+ *   limit           : size of the tables (maximum number of coroutines awaiting the objects at the same time)
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+struct baseExecutor
+{
+	using promise_type = Coroutine::promise_type;
+
+	baseExecutor( sel_t *_sel, baseAwaiter **_awt, unsigned _limit ): select_(_sel), waiter_(_awt), size_(_limit) {}
+
+	baseExecutor( baseExecutor&& ) = delete;
+	baseExecutor( const baseExecutor& ) = delete;
+	baseExecutor& operator=( baseExecutor&& ) = delete;
+	baseExecutor& operator=( const baseExecutor& ) = delete;
+
+	~baseExecutor( void ) { assert(alive_ == 0); }
+
+/******************************************************************************
+ *
+ * Name              : baseExecutor::spawn
+ *
+ * Description       : take over the coroutine and make it ready to run
+ *
+ * Parameters
+ *   co              : coroutine
+ *
+ * Return
+ *   true            : coroutine was taken over
+ *   false           : coroutine is invalid (not created)
+ *
+ * Note              : use only before run or in the coroutines of the executor
+ *
+ ******************************************************************************/
+
+	bool spawn( Coroutine&& _co )
+	{
+		auto co = _co.release();
+		if (co == nullptr)
+			return false;
+		co->exe = this;
+		alive_++;
+		ready(co);
+		return true;
+	}
+
+/******************************************************************************
+ *
+ * Name              : baseExecutor::run
+ *
+ * Description       : execute the coroutines until all of them have finished
+ *
+ * Parameters        : none
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	void run( void )
+	{
+		for (;;)
+		{
+			resume();
+			if (alive_ == 0)
+				break;
+			cnt_t delay = head_ != nullptr ? IMMEDIATE : timeout();
+			if (count_ > 0)
+				sel_waitFor(select_, count_, delay);
+			else
+			if (delay != IMMEDIATE)
+				tsk_sleepFor(delay);
+			update();
+		}
+	}
+
+	unsigned alive( void ) { return alive_; }
+
+	// append the coroutine to the ready queue
+	void ready( promise_type *_co )
+	{
+		_co->next = nullptr;
+		if (head_ == nullptr)
+			head_ = _co;
+		else
+			tail_->next = _co;
+		tail_ = _co;
+	}
+
+	// register the suspended coroutine awaiting the object or sleeping
+	void await( baseAwaiter *_awt )
+	{
+		if (_awt->sel.obj == nullptr)
+		{
+			_awt->next = sleep_;
+			sleep_ = _awt;
+		}
+		else
+		{
+			assert(count_ < size_);
+			select_[count_] = _awt->sel;
+			waiter_[count_] = _awt;
+			count_++;
+		}
+	}
+
+	private:
+
+	// resume all the coroutines that are ready at the moment
+	void resume( void )
+	{
+		promise_type *co = head_;
+		promise_type *nxt;
+
+		head_ = tail_ = nullptr;
+		for (; co != nullptr; co = nxt)
+		{
+			nxt = co->next;
+			auto h = Coroutine::handle::from_promise(*co);
+			h.resume();
+			if (h.done())
+			{
+				h.destroy();
+				alive_--;
+			}
+		}
+	}
+
+	// duration of time to the nearest timeout of the suspended coroutines
+	cnt_t timeout( void )
+	{
+		cnt_t now   = sys_time();
+		cnt_t delay = INFINITE;
+		auto  check = [&]( baseAwaiter *_awt )
+		{
+			if (_awt->delay == INFINITE)
+				return;
+			cnt_t time = now - _awt->start;
+			cnt_t left = time >= _awt->delay ? IMMEDIATE : _awt->delay - time;
+			if (delay > left)
+				delay = left;
+		};
+
+		for (unsigned i = 0; i < count_; i++)
+			check(waiter_[i]);
+		for (baseAwaiter *awt = sleep_; awt != nullptr; awt = awt->next)
+			check(awt);
+
+		return delay;
+	}
+
+	// take the awaited objects and make ready the coroutines that have got the object or whose timeout has expired
+	void update( void )
+	{
+		cnt_t now = sys_time();
+
+		for (unsigned i = 0; i < count_; )
+		{
+			baseAwaiter *awt = waiter_[i];
+			awt->event = awt->take();
+			if (awt->event == E_TIMEOUT && !awt->expired(now))
+			{
+				i++;
+				continue;
+			}
+			count_--;
+			select_[i] = select_[count_];
+			waiter_[i] = waiter_[count_];
+			ready(awt->co);
+		}
+
+		for (baseAwaiter **awt = &sleep_; *awt != nullptr; )
+		{
+			if (!(*awt)->expired(now))
+			{
+				awt = &(*awt)->next;
+				continue;
+			}
+			ready((*awt)->co);
+			*awt = (*awt)->next;
+		}
+	}
+
+	sel_t        * const select_;
+	baseAwaiter ** const waiter_;
+	const unsigned size_;
+	unsigned       count_ = 0;       // number of coroutines awaiting the objects
+	unsigned       alive_ = 0;       // number of coroutines taken over and not finished
+	promise_type * head_  = nullptr; // ready queue
+	promise_type * tail_  = nullptr;
+	baseAwaiter  * sleep_ = nullptr; // list of sleeping coroutines
+};
+
+/* -------------------------------------------------------------------------- */
+
+inline
+void baseAwaiter::await_suspend( Coroutine::handle _h )
+{
+	co = &_h.promise();
+	co->exe->await(this);
+}
+
+/******************************************************************************
+ *
+ * Class             : baseYield
+ *
+ * Description       : passing control to the next ready coroutine
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+struct baseYield
+{
+	bool await_ready  ( void )                { return false; }
+	void await_suspend( Coroutine::handle _h ) { _h.promise().exe->ready(&_h.promise()); }
+	void await_resume ( void )                {}
+};
+
+/******************************************************************************
+ *
+ * Class             : baseSelect
+ *
+ * Description       : tables of the awaited objects
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+template<unsigned limit_>
+struct baseSelect
+{
+	static_assert(limit_>0, "incorrect executor limit");
+	sel_t         sel_[limit_];
+	baseAwaiter * awt_[limit_];
+};
+
+/******************************************************************************
+ *
+ * Class             : ExecutorT<>
+ *
+ * Description       : create and initialize an executor of the coroutines
+ *
+ * Constructor parameters
+ *   limit           : maximum number of coroutines awaiting the objects at the same time
+ *                     (sleeping and ready coroutines are not limited)
+ *
+ ******************************************************************************/
+
+template<unsigned limit_>
+struct ExecutorT : public baseSelect<limit_>, public baseExecutor
+{
+	ExecutorT( void ): baseExecutor(baseSelect<limit_>::sel_, baseSelect<limit_>::awt_, limit_) {}
+};
+
+/******************************************************************************
+ *
+ * Class             : ThisCoroutine
+ *
+ * Description       : awaitable operations of the current coroutine
+ *
+ * Note              : co_await returns event value of the operation (E_SUCCESS / E_TIMEOUT)
+ *                     object is taken by the executor on behalf of the coroutine
+ *
+ ******************************************************************************/
+
+struct ThisCoroutine
+{
+	template<typename T> static
+	baseAwaiter waitFor  ( sem_t &_sem, const T _delay )                  { return baseAwaiter(&_sem, selSemaphore,    0,      nullptr, Clock::count(_delay)); }
+	template<typename T> static
+	baseAwaiter waitUntil( sem_t &_sem, const T _time )                   { return baseAwaiter(&_sem, selSemaphore,    0,      nullptr, until(Clock::until(_time))); }
+	static
+	baseAwaiter wait     ( sem_t &_sem )                                  { return waitFor(_sem, INFINITE); }
+	template<typename T> static
+	baseAwaiter waitFor  ( box_t &_box, void *_data, const T _delay )     { return baseAwaiter(&_box, selMailboxQueue, 0,      _data,   Clock::count(_delay)); }
+	template<typename T> static
+	baseAwaiter waitUntil( box_t &_box, void *_data, const T _time )      { return baseAwaiter(&_box, selMailboxQueue, 0,      _data,   until(Clock::until(_time))); }
+	static
+	baseAwaiter wait     ( box_t &_box, void *_data )                     { return waitFor(_box, _data, INFINITE); }
+	template<typename T> static
+	baseAwaiter waitFor  ( evq_t &_evq, unsigned *_data, const T _delay ) { return baseAwaiter(&_evq, selEventQueue,   0,      _data,   Clock::count(_delay)); }
+	template<typename T> static
+	baseAwaiter waitUntil( evq_t &_evq, unsigned *_data, const T _time )  { return baseAwaiter(&_evq, selEventQueue,   0,      _data,   until(Clock::until(_time))); }
+	static
+	baseAwaiter wait     ( evq_t &_evq, unsigned *_data )                 { return waitFor(_evq, _data, INFINITE); }
+	template<typename T> static
+	baseAwaiter waitFor  ( flg_t &_flg, unsigned _flags, const T _delay ) { return baseAwaiter(&_flg, selFlag,         _flags, nullptr, Clock::count(_delay)); }
+	template<typename T> static
+	baseAwaiter waitUntil( flg_t &_flg, unsigned _flags, const T _time )  { return baseAwaiter(&_flg, selFlag,         _flags, nullptr, until(Clock::until(_time))); }
+	static
+	baseAwaiter wait     ( flg_t &_flg, unsigned _flags )                 { return waitFor(_flg, _flags, INFINITE); }
+	template<typename T> static
+	baseAwaiter sleepFor ( const T _delay )                               { return baseAwaiter(nullptr, 0,             0,      nullptr, Clock::count(_delay)); }
+	template<typename T> static
+	baseAwaiter sleepUntil( const T _time )                               { return baseAwaiter(nullptr, 0,             0,      nullptr, until(Clock::until(_time))); }
+	static
+	baseYield   yield    ( void )                                         { return baseYield(); }
+
+	private:
+	static
+	cnt_t until( cnt_t _time ) { cnt_t delay = _time - sys_time(); return delay - 1 > CNT_LIMIT ? IMMEDIATE : delay; }
+};
+
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOSCORO_H
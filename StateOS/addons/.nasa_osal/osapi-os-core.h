@@ -57,6 +57,7 @@ typedef struct
     uint32 stack_size;
     uint32 priority;
     uint32 OStask_id;
+    uint64 run_time; /* StateOS: run time of the task, in cycles of the cycle counter */
 }OS_task_prop_t;
     
 /* queues */
@@ -24,7 +24,7 @@
 
     @file    StateOS: osapi.c
     @author  Rajmund Szymanski
-    @date    09.06.2020
+    @date    18.10.2026
     @brief   NASA OSAPI implementation for StateOS.
 
  ******************************************************************************
@@ -180,7 +180,7 @@ int32 OS_QueueCreate(uint32 *queue_id, const char *queue_name, uint32 queue_dept
 
 	(void) flags;
 
-	sys_lock();
+	sys_schedLock();
 	{
 		if (!queue_id || !queue_name)
 			status = OS_INVALID_POINTER;
@@ -223,7 +223,7 @@ int32 OS_QueueCreate(uint32 *queue_id, const char *queue_name, uint32 queue_dept
 			}
 		}
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return status;
 }
@@ -315,7 +315,7 @@ int32 OS_QueueGetIdByName(uint32 *queue_id, const char *queue_name)
 	OS_queue_record_t *rec;
 	int32 status;
 
-	sys_lock();
+	sys_schedLock();
 	{
 		if (!queue_id || !queue_name)
 			status = OS_INVALID_POINTER;
@@ -337,7 +337,7 @@ int32 OS_QueueGetIdByName(uint32 *queue_id, const char *queue_name)
 			}
 		}
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return status;
 }
@@ -377,7 +377,7 @@ int32 OS_BinSemCreate(uint32 *semaphore_id, const char *sem_name, uint32 sem_ini
 
 	(void) options;
 
-	sys_lock();
+	sys_schedLock();
 	{
 		if (!semaphore_id || !sem_name)
 			status = OS_INVALID_POINTER;
@@ -412,7 +412,7 @@ int32 OS_BinSemCreate(uint32 *semaphore_id, const char *sem_name, uint32 sem_ini
 			}
 		}
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return status;
 }
@@ -534,7 +534,7 @@ int32 OS_BinSemGetIdByName(uint32 *semaphore_id, const char *sem_name)
 	OS_bin_sem_record_t *rec;
 	int32 status;
 
-	sys_lock();
+	sys_schedLock();
 	{
 		if (!semaphore_id || !sem_name)
 			status = OS_INVALID_POINTER;
@@ -556,7 +556,7 @@ int32 OS_BinSemGetIdByName(uint32 *semaphore_id, const char *sem_name)
 			}
 		}
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return status;
 }
@@ -594,7 +594,7 @@ int32 OS_CountSemCreate(uint32 *semaphore_id, const char *sem_name, uint32 sem_i
 
 	(void) options;
 
-	sys_lock();
+	sys_schedLock();
 	{
 		if (!semaphore_id || !sem_name)
 			status = OS_INVALID_POINTER;
@@ -629,7 +629,7 @@ int32 OS_CountSemCreate(uint32 *semaphore_id, const char *sem_name, uint32 sem_i
 			}
 		}
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return status;
 }
@@ -729,7 +729,7 @@ int32 OS_CountSemGetIdByName(uint32 *semaphore_id, const char *sem_name)
 	OS_count_sem_record_t *rec;
 	int32 status;
 
-	sys_lock();
+	sys_schedLock();
 	{
 		if (!semaphore_id || !sem_name)
 			status = OS_INVALID_POINTER;
@@ -751,7 +751,7 @@ int32 OS_CountSemGetIdByName(uint32 *semaphore_id, const char *sem_name)
 			}
 		}
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return status;
 }
@@ -792,7 +792,7 @@ int32 OS_MutSemCreate(uint32 *semaphore_id, const char *sem_name, uint32 options
 
 	(void) options;
 
-	sys_lock();
+	sys_schedLock();
 	{
 		if (!semaphore_id || !sem_name)
 			status = OS_INVALID_POINTER;
@@ -827,7 +827,7 @@ int32 OS_MutSemCreate(uint32 *semaphore_id, const char *sem_name, uint32 options
 			}
 		}
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return status;
 }
@@ -904,7 +904,7 @@ int32 OS_MutSemGetIdByName(uint32 *semaphore_id, const char *sem_name)
 	OS_mut_sem_record_t *rec;
 	int32 status;
 
-	sys_lock();
+	sys_schedLock();
 	{
 		if (!semaphore_id || !sem_name)
 			status = OS_INVALID_POINTER;
@@ -926,7 +926,7 @@ int32 OS_MutSemGetIdByName(uint32 *semaphore_id, const char *sem_name)
 			}
 		}
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return status;
 }
@@ -978,7 +978,7 @@ int32 OS_TaskCreate(uint32 *task_id, const char *task_name, osal_task_entry func
 
 	(void) flags;
 
-	sys_lock();
+	sys_schedLock();
 	{
 		if (!task_id || !task_name || !function_pointer)
 			status = OS_INVALID_POINTER;
@@ -1030,7 +1030,7 @@ int32 OS_TaskCreate(uint32 *task_id, const char *task_name, osal_task_entry func
 			}
 		}
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return status;
 }
@@ -1141,7 +1141,7 @@ int32 OS_TaskGetIdByName(uint32 *task_id, const char *task_name)
 	OS_task_record_t *rec;
 	int32 status;
 
-	sys_lock();
+	sys_schedLock();
 	{
 		if (!task_id || !task_name)
 			status = OS_INVALID_POINTER;
@@ -1163,7 +1163,7 @@ int32 OS_TaskGetIdByName(uint32 *task_id, const char *task_name)
 			}
 		}
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return status;
 }
@@ -1186,6 +1186,7 @@ int32 OS_TaskGetInfo(uint32 task_id, OS_task_prop_t *task_prop)
 			task_prop->stack_size = (uint32_t) rec->tsk.size;
 			task_prop->priority = ~rec->tsk.basic;
 			task_prop->OStask_id = (uint32) &rec->tsk;
+			task_prop->run_time = tsk_getRunTime(&rec->tsk);
 			status = OS_SUCCESS;
 		}
 	}
@@ -1441,7 +1442,7 @@ int32 OS_TimerCreate(uint32 *timer_id, const char *timer_name, uint32 *clock_acc
 	OS_timer_record_t *rec;
 	int32 status;
 
-	sys_lock();
+	sys_schedLock();
 	{
 		if (!timer_id || !timer_name || !callback_ptr)
 			status = OS_INVALID_POINTER;
@@ -1480,7 +1481,7 @@ int32 OS_TimerCreate(uint32 *timer_id, const char *timer_name, uint32 *clock_acc
 			}
 		}
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return status;
 }
@@ -1535,7 +1536,7 @@ int32 OS_TimerGetIdByName(uint32 *timer_id, const char *timer_name)
 	OS_timer_record_t *rec;
 	int32 status;
 
-	sys_lock();
+	sys_schedLock();
 	{
 		if (!timer_id || !timer_name)
 			status = OS_INVALID_POINTER;
@@ -1557,7 +1558,7 @@ int32 OS_TimerGetIdByName(uint32 *timer_id, const char *timer_name)
 			}
 		}
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return status;
 }
@@ -0,0 +1,883 @@
+/******************************************************************************
+
+    @file    StateOS: osactiveobject.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOS_AOB_H
+#define __STATEOS_AOB_H
+
+#include "oskernel.h"
+#include "osclock.h"
+#include "osmemorypool.h"
+#include "osmailboxqueue.h"
+#include "ostimer.h"
+
+/* -------------------------------------------------------------------------- */
+
+#define BUS_LIMIT ( 32U ) // max number of active objects subscribed to the event bus
+
+/******************************************************************************
+ *
+ * Name              : active event
+ *
+ * Note              : user event structure begins with the active event header
+ *                     dynamic event is allocated from the memory pool and returned to it
+ *                     after it has been handled by all the recipients (reference counter)
+ *                     static event (not allocated from any memory pool) is never recycled
+ *                     and can be placed in read-only memory
+ *
+ ******************************************************************************/
+
+typedef struct __aev aev_t, * const aev_id;
+typedef struct __aob aob_t, * const aob_id;
+typedef struct __bus bus_t, * const bus_id;
+typedef struct __tev tev_t, * const tev_id;
+
+typedef         void evh_t(aob_t *, const aev_t *); // event handler of the active object
+
+struct __aev
+{
+	unsigned signal;// signal of the event
+	unsigned refs;  // number of references to the dynamic event
+	mem_t  * mem;   // memory pool of the dynamic event; NULL: static event
+};
+
+/******************************************************************************
+ *
+ * Name              : active object
+ *
+ * Note              : events are passed by pointers, only the pointer is copied into the event queue
+ *                     events are handled to completion by the task waiting for the active object (aob_wait)
+ *
+ ******************************************************************************/
+
+struct __aob
+{
+	box_t    box;   // event queue (pointers to the events)
+	evh_t  * proc;  // event handler
+};
+
+/******************************************************************************
+ *
+ * Name              : event bus (publish-subscribe)
+ *
+ ******************************************************************************/
+
+struct __bus
+{
+	aob_t  * list[BUS_LIMIT]; // active objects subscribed to the event bus
+	unsigned limit; // number of signals
+	uint32_t*subs;  // subscribers of the signals (bit n refers to the active object list[n])
+};
+
+/******************************************************************************
+ *
+ * Name              : time event
+ *
+ * Note              : static event posted to the active object by the timer
+ *
+ ******************************************************************************/
+
+struct __tev
+{
+	tmr_t    tmr;   // timer of the time event
+	aev_t    aev;   // event posted to the active object
+	aob_t  * aob;   // recipient of the time event
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _AEV_INIT
+ *
+ * Description       : create and initialize a static event
+ *
+ * Parameters
+ *   signal          : signal of the event
+ *
+ * Return            : active event header
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _AEV_INIT( _signal ) { _signal, 0, NULL }
+
+/******************************************************************************
+ *
+ * Name              : AEV_INIT
+ *
+ * Description       : create and initialize a static event
+ *
+ * Parameters
+ *   signal          : signal of the event
+ *
+ * Return            : active event header
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                AEV_INIT( signal ) \
+                      _AEV_INIT( signal )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _AOB_INIT
+ *
+ * Description       : create and initialize an active object
+ *
+ * Parameters
+ *   limit           : size of the event queue (max number of stored events)
+ *   handler         : event handler of the active object
+ *   data            : event queue data buffer
+ *
+ * Return            : active object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _AOB_INIT( _limit, _handler, _data ) { _BOX_INIT( _limit, sizeof(aev_t *), _data ), _handler }
+
+/******************************************************************************
+ *
+ * Name              : OS_AOB
+ *
+ * Description       : define and initialize an active object
+ *
+ * Parameters
+ *   aob             : name of a pointer to active object
+ *   limit           : size of the event queue (max number of stored events)
+ *   handler         : event handler of the active object
+ *
+ ******************************************************************************/
+
+#define             OS_AOB( aob, limit, handler )                                    \
+                       char aob##__buf[limit * sizeof(aev_t *)];                      \
+                       aob_t aob##__aob = _AOB_INIT( limit, handler, aob##__buf );     \
+                       aob_id aob = & aob##__aob
+
+/******************************************************************************
+ *
+ * Name              : static_AOB
+ *
+ * Description       : define and initialize a static active object
+ *
+ * Parameters
+ *   aob             : name of a pointer to active object
+ *   limit           : size of the event queue (max number of stored events)
+ *   handler         : event handler of the active object
+ *
+ ******************************************************************************/
+
+#define         static_AOB( aob, limit, handler )                                    \
+                static char aob##__buf[limit * sizeof(aev_t *)];                      \
+                static aob_t aob##__aob = _AOB_INIT( limit, handler, aob##__buf );     \
+                static aob_id aob = & aob##__aob
+
+/******************************************************************************
+ *
+ * Name              : AOB_INIT
+ *
+ * Description       : create and initialize an active object
+ *
+ * Parameters
+ *   limit           : size of the event queue (max number of stored events)
+ *   handler         : event handler of the active object
+ *
+ * Return            : active object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                AOB_INIT( limit, handler ) \
+                      _AOB_INIT( limit, handler, _BOX_DATA( limit, sizeof(aev_t *) ) )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _BUS_INIT
+ *
+ * Description       : create and initialize an event bus object
+ *
+ * Parameters
+ *   limit           : number of signals
+ *   subs            : table of subscribers of the signals
+ *
+ * Return            : event bus object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _BUS_INIT( _limit, _subs ) { { NULL }, _limit, _subs }
+
+/******************************************************************************
+ *
+ * Name              : OS_BUS
+ *
+ * Description       : define and initialize an event bus object
+ *
+ * Parameters
+ *   bus             : name of a pointer to event bus object
+ *   limit           : number of signals
+ *
+ ******************************************************************************/
+
+#define             OS_BUS( bus, limit )                                \
+                       uint32_t bus##__subs[limit];                      \
+                       bus_t bus##__bus = _BUS_INIT( limit, bus##__subs ); \
+                       bus_id bus = & bus##__bus
+
+/******************************************************************************
+ *
+ * Name              : static_BUS
+ *
+ * Description       : define and initialize a static event bus object
+ *
+ * Parameters
+ *   bus             : name of a pointer to event bus object
+ *   limit           : number of signals
+ *
+ ******************************************************************************/
+
+#define         static_BUS( bus, limit )                                \
+                static uint32_t bus##__subs[limit];                      \
+                static bus_t bus##__bus = _BUS_INIT( limit, bus##__subs ); \
+                static bus_id bus = & bus##__bus
+
+/******************************************************************************
+ *
+ * Name              : BUS_INIT
+ *
+ * Description       : create and initialize an event bus object
+ *
+ * Parameters
+ *   limit           : number of signals
+ *
+ * Return            : event bus object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                BUS_INIT( limit ) \
+                      _BUS_INIT( limit, (uint32_t[limit]){ 0 } )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _TEV_INIT
+ *
+ * Description       : create and initialize a time event object
+ *
+ * Parameters
+ *   aob             : pointer to active object (recipient of the time event)
+ *   signal          : signal of the time event
+ *
+ * Return            : time event object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _TEV_INIT( _aob, _signal ) { _TMR_INIT( core_tev_handler ), _AEV_INIT( _signal ), _aob }
+
+// timer callback procedure of the time event; posts the time event to its active object
+void core_tev_handler( void );
+
+/******************************************************************************
+ *
+ * Name              : OS_TEV
+ *
+ * Description       : define and initialize a time event object
+ *
+ * Parameters
+ *   tev             : name of a pointer to time event object
+ *   aob             : name of a pointer to active object (recipient of the time event)
+ *   signal          : signal of the time event
+ *
+ * Note              : active object must be defined with OS_AOB or static_AOB in the same file
+ *
+ ******************************************************************************/
+
+#define             OS_TEV( tev, aob, signal )                                \
+                       tev_t tev##__tev = _TEV_INIT( & aob##__aob, signal );   \
+                       tev_id tev = & tev##__tev
+
+/******************************************************************************
+ *
+ * Name              : static_TEV
+ *
+ * Description       : define and initialize a static time event object
+ *
+ * Parameters
+ *   tev             : name of a pointer to time event object
+ *   aob             : name of a pointer to active object (recipient of the time event)
+ *   signal          : signal of the time event
+ *
+ * Note              : active object must be defined with OS_AOB or static_AOB in the same file
+ *
+ ******************************************************************************/
+
+#define         static_TEV( tev, aob, signal )                                \
+                static tev_t tev##__tev = _TEV_INIT( & aob##__aob, signal );   \
+                static tev_id tev = & tev##__tev
+
+/******************************************************************************
+ *
+ * Name              : TEV_INIT
+ *
+ * Description       : create and initialize a time event object
+ *
+ * Parameters
+ *   aob             : pointer to active object (recipient of the time event)
+ *   signal          : signal of the time event
+ *
+ * Return            : time event object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                TEV_INIT( aob, signal ) \
+                      _TEV_INIT( aob, signal )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : aev_alloc
+ * ISR alias         : aev_allocISR
+ *
+ * Description       : allocate a dynamic event from the memory pool, don't wait if the memory pool is empty
+ *
+ * Parameters
+ *   mem             : pointer to memory pool object
+ *   signal          : signal of the event
+ *
+ * Return            : pointer to the allocated event
+ *   NULL            : memory pool is empty
+ *
+ * Note              : may be used both in thread and handler mode
+ *                     size of the memory object must not be less than the size of the active event header
+ *                     allocated event must be posted or published, it is recycled when all recipients have handled it
+ *
+ ******************************************************************************/
+
+aev_t *aev_alloc( mem_t *mem, unsigned signal );
+
+__STATIC_INLINE
+aev_t *aev_allocISR( mem_t *mem, unsigned signal ) { return aev_alloc(mem, signal); }
+
+/******************************************************************************
+ *
+ * Name              : aob_init
+ *
+ * Description       : initialize an active object
+ *
+ * Parameters
+ *   aob             : pointer to active object
+ *   handler         : event handler of the active object
+ *   data            : event queue data buffer
+ *   bufsize         : size of the data buffer (in bytes)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void aob_init( aob_t *aob, evh_t *handler, void *data, size_t bufsize );
+
+/******************************************************************************
+ *
+ * Name              : aob_reset
+ * Alias             : aob_kill
+ *
+ * Description       : reset the active object, release all the queued events
+ *                     and wake up all waiting tasks with 'E_STOPPED' event value
+ *
+ * Parameters
+ *   aob             : pointer to active object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void aob_reset( aob_t *aob );
+
+__STATIC_INLINE
+void aob_kill( aob_t *aob ) { aob_reset(aob); }
+
+/******************************************************************************
+ *
+ * Name              : aob_post
+ * ISR alias         : aob_postISR
+ *
+ * Description       : post the event to the active object,
+ *                     don't wait if the event queue of the active object is full
+ *
+ * Parameters
+ *   aob             : pointer to active object
+ *   aev             : pointer to the event
+ *
+ * Return
+ *   E_SUCCESS       : event was successfully posted to the active object
+ *   E_TIMEOUT       : event queue of the active object is full, dynamic event has been recycled if not referenced
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+unsigned aob_post( aob_t *aob, const aev_t *aev );
+
+__STATIC_INLINE
+unsigned aob_postISR( aob_t *aob, const aev_t *aev ) { return aob_post(aob, aev); }
+
+/******************************************************************************
+ *
+ * Name              : aob_take
+ * Alias             : aob_tryWait
+ *
+ * Description       : take the first event from the event queue of the active object and handle it,
+ *                     don't wait if the event queue is empty
+ *
+ * Parameters
+ *   aob             : pointer to active object
+ *
+ * Return
+ *   E_SUCCESS       : event was successfully handled
+ *   E_TIMEOUT       : event queue is empty, try again
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned aob_take( aob_t *aob );
+
+__STATIC_INLINE
+unsigned aob_tryWait( aob_t *aob ) { return aob_take(aob); }
+
+/******************************************************************************
+ *
+ * Name              : aob_waitFor
+ *
+ * Description       : wait for the event of the active object for given duration of time and handle it
+ *
+ * Parameters
+ *   aob             : pointer to active object
+ *   delay           : duration of time (maximum number of ticks to wait for the event)
+ *                     IMMEDIATE: don't wait if the event queue is empty
+ *                     INFINITE:  wait indefinitely for the event
+ *
+ * Return
+ *   E_SUCCESS       : event was successfully handled
+ *   E_STOPPED       : active object was reseted before the specified timeout expired
+ *   E_TIMEOUT       : no event was posted before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned aob_waitFor( aob_t *aob, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : aob_waitUntil
+ *
+ * Description       : wait for the event of the active object until given timepoint and handle it
+ *
+ * Parameters
+ *   aob             : pointer to active object
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : event was successfully handled
+ *   E_STOPPED       : active object was reseted before the specified timeout expired
+ *   E_TIMEOUT       : no event was posted before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned aob_waitUntil( aob_t *aob, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : aob_wait
+ *
+ * Description       : wait indefinitely for the event of the active object and handle it
+ *
+ * Parameters
+ *   aob             : pointer to active object
+ *
+ * Return
+ *   E_SUCCESS       : event was successfully handled
+ *   E_STOPPED       : active object was reseted
+ *
+ * Note              : use only in thread mode
+ *                     use it in the state function of the task of the active object (dispatch loop)
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+unsigned aob_wait( aob_t *aob ) { return aob_waitFor(aob, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : bus_init
+ *
+ * Description       : initialize an event bus object
+ *
+ * Parameters
+ *   bus             : pointer to event bus object
+ *   subs            : table of subscribers of the signals
+ *   limit           : number of signals
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void bus_init( bus_t *bus, uint32_t *subs, unsigned limit );
+
+/******************************************************************************
+ *
+ * Name              : bus_subscribe
+ *
+ * Description       : subscribe the active object to the signal of the event bus
+ *
+ * Parameters
+ *   bus             : pointer to event bus object
+ *   aob             : pointer to active object
+ *   signal          : signal of the events
+ *
+ * Return
+ *   E_SUCCESS       : active object was successfully subscribed
+ *   E_FAILURE       : too many active objects are subscribed to the event bus
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned bus_subscribe( bus_t *bus, aob_t *aob, unsigned signal );
+
+/******************************************************************************
+ *
+ * Name              : bus_unsubscribe
+ *
+ * Description       : unsubscribe the active object from the signal of the event bus
+ *                     the active object not subscribed to any signal is removed from the event bus
+ *
+ * Parameters
+ *   bus             : pointer to event bus object
+ *   aob             : pointer to active object
+ *   signal          : signal of the events
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void bus_unsubscribe( bus_t *bus, aob_t *aob, unsigned signal );
+
+/******************************************************************************
+ *
+ * Name              : bus_publish
+ * ISR alias         : bus_publishISR
+ *
+ * Description       : post the event to all the active objects subscribed to its signal
+ *
+ * Parameters
+ *   bus             : pointer to event bus object
+ *   aev             : pointer to the event
+ *
+ * Return            : number of active objects the event was posted to
+ *
+ * Note              : may be used both in thread and handler mode
+ *                     dynamic event is recycled if it was not posted to any active object
+ *
+ ******************************************************************************/
+
+unsigned bus_publish( bus_t *bus, const aev_t *aev );
+
+__STATIC_INLINE
+unsigned bus_publishISR( bus_t *bus, const aev_t *aev ) { return bus_publish(bus, aev); }
+
+/******************************************************************************
+ *
+ * Name              : tev_init
+ *
+ * Description       : initialize a time event object
+ *
+ * Parameters
+ *   tev             : pointer to time event object
+ *   aob             : pointer to active object (recipient of the time event)
+ *   signal          : signal of the time event
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void tev_init( tev_t *tev, aob_t *aob, unsigned signal );
+
+/******************************************************************************
+ *
+ * Name              : tev_start
+ *
+ * Description       : start/restart the time event
+ *
+ * Parameters
+ *   tev             : pointer to time event object
+ *   delay           : duration of time (maximum number of ticks to countdown) for the first expiration
+ *                     IMMEDIATE: don't countdown
+ *                     INFINITE:  countdown indefinitely
+ *   period          : duration of time (maximum number of ticks to countdown) for all next expirations
+ *                     IMMEDIATE: don't countdown
+ *                     INFINITE:  countdown indefinitely
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+void tev_start( tev_t *tev, cnt_t delay, cnt_t period ) { tmr_start(&tev->tmr, delay, period); }
+
+/******************************************************************************
+ *
+ * Name              : tev_startFor
+ *
+ * Description       : start/restart the one-shot time event
+ *
+ * Parameters
+ *   tev             : pointer to time event object
+ *   delay           : duration of time (maximum number of ticks to countdown)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+void tev_startFor( tev_t *tev, cnt_t delay ) { tmr_startFor(&tev->tmr, delay); }
+
+/******************************************************************************
+ *
+ * Name              : tev_startPeriodic
+ *
+ * Description       : start/restart the periodic time event
+ *
+ * Parameters
+ *   tev             : pointer to time event object
+ *   period          : duration of time (maximum number of ticks to countdown)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+void tev_startPeriodic( tev_t *tev, cnt_t period ) { tmr_startPeriodic(&tev->tmr, period); }
+
+/******************************************************************************
+ *
+ * Name              : tev_stop
+ *
+ * Description       : stop the time event without posting it
+ *
+ * Parameters
+ *   tev             : pointer to time event object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     time event already posted to the active object is not removed from its event queue
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+void tev_stop( tev_t *tev ) { tmr_reset(&tev->tmr); }
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+
+/******************************************************************************
+ *
+ * Class             : ActiveEvent
+ *
+ * Description       : create and initialize a static event
+ *
+ * Constructor parameters
+ *   signal          : signal of the event
+ *
+ * Note              : user event class derives from the ActiveEvent class
+ *
+ ******************************************************************************/
+
+struct ActiveEvent : public __aev
+{
+	constexpr
+	ActiveEvent( unsigned _signal ): __aev _AEV_INIT(_signal) {}
+};
+
+/******************************************************************************
+ *
+ * Class             : ActiveObjectT<>
+ *
+ * Description       : create and initialize an active object
+ *
+ * Constructor parameters
+ *   limit           : size of the event queue (max number of stored events)
+ *   handler         : event handler of the active object
+ *
+ ******************************************************************************/
+
+template<unsigned limit_>
+struct ActiveObjectT : public __aob
+{
+	constexpr
+	ActiveObjectT( evh_t *_handler ): __aob _AOB_INIT(limit_, _handler, data_) {}
+
+	ActiveObjectT( ActiveObjectT&& ) = default;
+	ActiveObjectT( const ActiveObjectT& ) = delete;
+	ActiveObjectT& operator=( ActiveObjectT&& ) = delete;
+	ActiveObjectT& operator=( const ActiveObjectT& ) = delete;
+
+	~ActiveObjectT( void ) { assert(__aob::box.obj.queue == nullptr); }
+
+	void reset    ( void )                 {        aob_reset    (this); }
+	void kill     ( void )                 {        aob_kill     (this); }
+	uint post     ( const aev_t *_aev )    { return aob_post     (this, _aev); }
+	uint postISR  ( const aev_t *_aev )    { return aob_postISR  (this, _aev); }
+	uint take     ( void )                 { return aob_take     (this); }
+	uint tryWait  ( void )                 { return aob_tryWait  (this); }
+	template<typename T>
+	uint waitFor  ( const T _delay )       { return aob_waitFor  (this, Clock::count(_delay)); }
+	template<typename T>
+	uint waitUntil( const T _time )        { return aob_waitUntil(this, Clock::until(_time)); }
+	uint wait     ( void )                 { return aob_wait     (this); }
+
+	private:
+	char data_[limit_ * sizeof(aev_t *)];
+};
+
+/******************************************************************************
+ *
+ * Class             : EventBusT<>
+ *
+ * Description       : create and initialize an event bus object
+ *
+ * Constructor parameters
+ *   limit           : number of signals
+ *
+ ******************************************************************************/
+
+template<unsigned limit_>
+struct EventBusT : public __bus
+{
+	constexpr
+	EventBusT( void ): __bus _BUS_INIT(limit_, subs_) {}
+
+	EventBusT( EventBusT&& ) = default;
+	EventBusT( const EventBusT& ) = delete;
+	EventBusT& operator=( EventBusT&& ) = delete;
+	EventBusT& operator=( const EventBusT& ) = delete;
+
+	uint subscribe  ( aob_t &_aob, unsigned _signal ) { return bus_subscribe  (this, &_aob, _signal); }
+	void unsubscribe( aob_t &_aob, unsigned _signal ) {        bus_unsubscribe(this, &_aob, _signal); }
+	uint publish    ( const aev_t *_aev )             { return bus_publish    (this, _aev); }
+	uint publishISR ( const aev_t *_aev )             { return bus_publishISR (this, _aev); }
+
+	private:
+	uint32_t subs_[limit_] {};
+};
+
+/******************************************************************************
+ *
+ * Class             : TimeEvent
+ *
+ * Description       : create and initialize a time event object
+ *
+ * Constructor parameters
+ *   aob             : active object (recipient of the time event)
+ *   signal          : signal of the time event
+ *
+ ******************************************************************************/
+
+struct TimeEvent : public __tev
+{
+	constexpr
+	TimeEvent( aob_t &_aob, unsigned _signal ): __tev _TEV_INIT(&_aob, _signal) {}
+
+	TimeEvent( TimeEvent&& ) = default;
+	TimeEvent( const TimeEvent& ) = delete;
+	TimeEvent& operator=( TimeEvent&& ) = delete;
+	TimeEvent& operator=( const TimeEvent& ) = delete;
+
+	~TimeEvent( void ) { assert(__tev::tmr.hdr.id == ID_STOPPED); }
+
+	template<typename T>
+	void start        ( const T _delay, const T _period ) {        tev_start        (this, Clock::count(_delay), Clock::count(_period)); }
+	template<typename T>
+	void startFor     ( const T _delay )                  {        tev_startFor     (this, Clock::count(_delay)); }
+	template<typename T>
+	void startPeriodic( const T _period )                 {        tev_startPeriodic(this, Clock::count(_period)); }
+	void stop         ( void )                            {        tev_stop         (this); }
+};
+
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_AOB_H
@@ -2,7 +2,7 @@
 
     @file    StateOS: osconditionvariable.h
     @author  Rajmund Szymanski
-    @date    06.06.2020
+    @date    18.10.2026
     @brief   This file contains definitions for StateOS.
 
  ******************************************************************************
@@ -321,6 +321,9 @@ unsigned cnd_wait( cnd_t *cnd, mtx_t *mtx ) { return cnd_waitFor(cnd, mtx, INFIN
  * Return            : none
  *
  * Note              : may be used both in thread and handler mode
+ *                     if the mutex associated with the waiting task is locked, the task is not released
+ *                     but moved directly to the BLOCKED queue of the mutex (wait morphing)
+ *                     if the mutex is free, it is handed over to the released task
  *
  ******************************************************************************/
 
@@ -2,7 +2,7 @@
 
     @file    StateOS: oscriticalsection.h
     @author  Rajmund Szymanski
-    @date    09.05.2020
+    @date    18.10.2026
     @brief   This file contains definitions for StateOS.
 
  ******************************************************************************
@@ -34,6 +34,28 @@
 
 #include "oskernel.h"
 
+/* -------------------------------------------------------------------------- */
+
+#define CRI_BINS          8 // number of bins of the histogram of the critical section durations
+
+/******************************************************************************
+ *
+ * Name              : critical section statistics
+ *
+ ******************************************************************************/
+
+typedef struct __cri cri_t;
+
+struct __cri
+{
+	const
+	char   * file;  // source file of the critical section
+	unsigned line;  // source line of the critical section
+	unsigned count; // number of measured intervals with locked interrupts
+	uint32_t max;   // the longest interval, in cycles of the cycle counter (CYC_FREQUENCY)
+	unsigned hist[CRI_BINS]; // histogram of intervals; bin 'n' counts intervals shorter than (64 << n) cycles, the last bin counts the rest
+};
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -142,9 +164,18 @@ lck_t core_get_lock( void )
  *
  ******************************************************************************/
 
+#if OS_LOCK_TRACE
+
+#define                sys_lock() \
+                       do { lck_t __LOCK = core_set_lock(); bool __TRACE = core_cri_enter(__FILE__, __LINE__)
+
+#else
+
 #define                sys_lock() \
                        do { lck_t __LOCK = core_set_lock()
 
+#endif
+
 #define                sys_lockISR() \
                        sys_lock()
 
@@ -164,12 +195,85 @@ lck_t core_get_lock( void )
  *
  ******************************************************************************/
 
+#if OS_LOCK_TRACE
+
+#define                sys_unlock() \
+                       core_cri_leave(__TRACE); core_put_lock(__LOCK); } while (0)
+
+#else
+
 #define                sys_unlock() \
                        core_put_lock(__LOCK); } while (0)
 
+#endif
+
 #define                sys_unlockISR() \
                        sys_unlock()
 
+/******************************************************************************
+ *
+ * Name              : sys_schedLock
+ *
+ * Description       : lock the scheduler / disable preemption of the current task
+ *                     interrupts remain enabled; context switches requested while the scheduler is locked are deferred
+ *
+ * Parameters        : none
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     calls can be nested; the scheduler is unlocked by the last matching sys_schedUnlock call
+ *                     protects only the data that is not shared with the interrupt handlers
+ *                     the current task must not wait, sleep or stop while the scheduler is locked
+ *
+ ******************************************************************************/
+
+void sys_schedLock( void );
+
+/******************************************************************************
+ *
+ * Name              : sys_schedUnlock
+ *
+ * Description       : unlock the scheduler / enable preemption of the current task
+ *                     context switch deferred while the scheduler was locked is performed immediately
+ *
+ * Parameters        : none
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void sys_schedUnlock( void );
+
+/******************************************************************************
+ *
+ * Name              : sys_lockStats
+ *
+ * Description       : copy statistics of the traced critical sections into the table
+ *
+ * Parameters
+ *   table           : pointer to the table of critical section statistics
+ *   count           : size of the table (number of records)
+ *
+ * Return            : number of records copied into the table
+ *
+ * Note              : use only when OS_LOCK_TRACE > 0
+ *                     critical sections are identified by the source file and line of the sys_lock call
+ *                     sections not fitting into the table of OS_LOCK_TRACE call sites are measured together
+ *                     and returned as the last record with 'file' == NULL; the table of (OS_LOCK_TRACE + 1) records holds all of them
+ *                     a critical section is measured from sys_lock to sys_unlock; nested sections are not measured separately
+ *                     the measurement is paused while a task is waiting inside the critical section
+ *                     durations are expressed in cycles of the cycle counter (CYC_FREQUENCY)
+ *                     may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+#if OS_LOCK_TRACE
+unsigned sys_lockStats( cri_t *table, unsigned count );
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -191,8 +295,18 @@ lck_t core_get_lock( void )
 
 struct CriticalSection
 {
+#if OS_LOCK_TRACE
+#ifdef __GNUC__
+	 CriticalSection( const char *file = __builtin_FILE(), unsigned line = __builtin_LINE() ):
+#else
+	 CriticalSection( const char *file = __FILE__, unsigned line = __LINE__ ):
+#endif
+	 lck_{core_set_lock()}, trc_{core_cri_enter(file, line)} {}
+	~CriticalSection( void ) { core_cri_leave(trc_); core_put_lock(lck_); }
+#else
 	 CriticalSection( void ) { lck_ = core_set_lock(); }
 	~CriticalSection( void ) { core_put_lock(lck_); }
+#endif
 
 	CriticalSection( CriticalSection&& ) = delete;
 	CriticalSection( const CriticalSection& ) = delete;
@@ -201,6 +315,31 @@ struct CriticalSection
 
 	private:
 	lck_t lck_;
+#if OS_LOCK_TRACE
+	bool  trc_;
+#endif
+};
+
+/******************************************************************************
+ *
+ * Class             : SchedulerLock
+ *
+ * Description       : create and initialize a scheduler lock guard object
+ *
+ * Constructor parameters
+ *                   : none
+ *
+ ******************************************************************************/
+
+struct SchedulerLock
+{
+	 SchedulerLock( void ) { sys_schedLock();   }
+	~SchedulerLock( void ) { sys_schedUnlock(); }
+
+	SchedulerLock( SchedulerLock&& ) = delete;
+	SchedulerLock( const SchedulerLock& ) = delete;
+	SchedulerLock& operator=( SchedulerLock&& ) = delete;
+	SchedulerLock& operator=( const SchedulerLock& ) = delete;
 };
 
 #endif//__cplusplus
@@ -0,0 +1,628 @@
+/******************************************************************************
+
+    @file    StateOS: oslightweighttask.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOS_LWT_H
+#define __STATEOS_LWT_H
+
+#include "oskernel.h"
+#include "osclock.h"
+
+/******************************************************************************
+ *
+ * Name              : lightweight task dispatcher
+ *
+ * Note              : lightweight tasks of the dispatcher are executed to completion, one by one,
+ *                     by the task (or tasks) waiting for the dispatcher (lwd_wait) with its stack and priority
+ *                     use one dispatcher and one task for all the lightweight tasks of the same priority
+ *                     a waiting task is released for every pending lightweight task,
+ *                     the next one when the preceding lightweight task is taken
+ *
+ ******************************************************************************/
+
+typedef struct __lwd lwd_t, * const lwd_id;
+typedef struct __lwt lwt_t, * const lwt_id;
+
+struct __lwd
+{
+	obj_t    obj;   // object header
+
+	lwt_t  * head;  // first activated lightweight task
+	lwt_t  * tail;  // last activated lightweight task
+};
+
+/******************************************************************************
+ *
+ * Name              : lightweight task
+ *
+ * Note              : handler of the lightweight task gets the set of events of all its activations since the previous execution
+ *                     handler must not block (run-to-completion)
+ *                     handler is never executed by two tasks at the same time; activations given while it is being executed
+ *                     are dispatched after its completion
+ *
+ ******************************************************************************/
+
+struct __lwt
+{
+	obj_t    obj;   // object header
+
+	lwt_t  * next;  // next activated lightweight task of the dispatcher
+	lwd_t  * lwd;   // dispatcher of the lightweight task
+	act_t  * state; // handler of the lightweight task
+	unsigned sigset;// pending events; lightweight task is activated if not zero
+	bool     busy;  // handler of the lightweight task is being executed
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _LWD_INIT
+ *
+ * Description       : create and initialize a lightweight task dispatcher object
+ *
+ * Parameters        : none
+ *
+ * Return            : lightweight task dispatcher object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _LWD_INIT() { _OBJ_INIT(), NULL, NULL }
+
+/******************************************************************************
+ *
+ * Name              : _LWT_INIT
+ *
+ * Description       : create and initialize a lightweight task object
+ *
+ * Parameters
+ *   lwd             : pointer to lightweight task dispatcher object
+ *   state           : handler of the lightweight task
+ *
+ * Return            : lightweight task object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _LWT_INIT( _lwd, _state ) { _OBJ_INIT(), NULL, _lwd, _state, 0, false }
+
+/******************************************************************************
+ *
+ * Name              : OS_LWD
+ *
+ * Description       : define and initialize a lightweight task dispatcher object
+ *
+ * Parameters
+ *   lwd             : name of a pointer to lightweight task dispatcher object
+ *
+ ******************************************************************************/
+
+#define             OS_LWD( lwd )                     \
+                       lwd_t lwd##__lwd = _LWD_INIT(); \
+                       lwd_id lwd = & lwd##__lwd
+
+/******************************************************************************
+ *
+ * Name              : static_LWD
+ *
+ * Description       : define and initialize a static lightweight task dispatcher object
+ *
+ * Parameters
+ *   lwd             : name of a pointer to lightweight task dispatcher object
+ *
+ ******************************************************************************/
+
+#define         static_LWD( lwd )                     \
+                static lwd_t lwd##__lwd = _LWD_INIT(); \
+                static lwd_id lwd = & lwd##__lwd
+
+/******************************************************************************
+ *
+ * Name              : OS_LWT
+ *
+ * Description       : define and initialize a lightweight task object
+ *
+ * Parameters
+ *   lwt             : name of a pointer to lightweight task object
+ *   lwd             : name of a lightweight task dispatcher defined with OS_LWD / static_LWD
+ *   state           : handler of the lightweight task
+ *
+ ******************************************************************************/
+
+#define             OS_LWT( lwt, lwd, state )                              \
+                       lwt_t lwt##__lwt = _LWT_INIT( & lwd##__lwd, state ); \
+                       lwt_id lwt = & lwt##__lwt
+
+/******************************************************************************
+ *
+ * Name              : static_LWT
+ *
+ * Description       : define and initialize a static lightweight task object
+ *
+ * Parameters
+ *   lwt             : name of a pointer to lightweight task object
+ *   lwd             : name of a lightweight task dispatcher defined with OS_LWD / static_LWD
+ *   state           : handler of the lightweight task
+ *
+ ******************************************************************************/
+
+#define         static_LWT( lwt, lwd, state )                              \
+                static lwt_t lwt##__lwt = _LWT_INIT( & lwd##__lwd, state ); \
+                static lwt_id lwt = & lwt##__lwt
+
+/******************************************************************************
+ *
+ * Name              : LWD_INIT
+ *
+ * Description       : create and initialize a lightweight task dispatcher object
+ *
+ * Parameters        : none
+ *
+ * Return            : lightweight task dispatcher object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                LWD_INIT() \
+                      _LWD_INIT()
+#endif
+
+/******************************************************************************
+ *
+ * Name              : LWT_INIT
+ *
+ * Description       : create and initialize a lightweight task object
+ *
+ * Parameters
+ *   lwd             : pointer to lightweight task dispatcher object
+ *   state           : handler of the lightweight task
+ *
+ * Return            : lightweight task object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                LWT_INIT( lwd, state ) \
+                      _LWT_INIT( lwd, state )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : lwd_init
+ *
+ * Description       : initialize a lightweight task dispatcher object
+ *
+ * Parameters
+ *   lwd             : pointer to lightweight task dispatcher object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void lwd_init( lwd_t *lwd );
+
+/******************************************************************************
+ *
+ * Name              : lwd_create
+ * Alias             : lwd_new
+ *
+ * Description       : create and initialize a new lightweight task dispatcher object
+ *
+ * Parameters        : none
+ *
+ * Return            : pointer to lightweight task dispatcher object
+ *   NULL            : object not created (not enough free memory)
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+lwd_t *lwd_create( void );
+
+__STATIC_INLINE
+lwd_t *lwd_new( void ) { return lwd_create(); }
+
+/******************************************************************************
+ *
+ * Name              : lwd_reset
+ * Alias             : lwd_kill
+ *
+ * Description       : reset the lightweight task dispatcher object, cancel all activations
+ *                     and wake up all waiting tasks with 'E_STOPPED' event value
+ *
+ * Parameters
+ *   lwd             : pointer to lightweight task dispatcher object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void lwd_reset( lwd_t *lwd );
+
+__STATIC_INLINE
+void lwd_kill( lwd_t *lwd ) { lwd_reset(lwd); }
+
+/******************************************************************************
+ *
+ * Name              : lwd_destroy
+ * Alias             : lwd_delete
+ *
+ * Description       : reset the lightweight task dispatcher object, cancel all activations,
+ *                     wake up all waiting tasks with 'E_DELETED' event value and free allocated resource
+ *
+ * Parameters
+ *   lwd             : pointer to lightweight task dispatcher object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     further activations of the lightweight tasks pending on the freed dispatcher are ignored
+ *                     other lightweight tasks of the freed dispatcher must not be activated again
+ *                     dispatcher must not be freed while a handler of its lightweight task is being executed
+ *
+ ******************************************************************************/
+
+void lwd_destroy( lwd_t *lwd );
+
+__STATIC_INLINE
+void lwd_delete( lwd_t *lwd ) { lwd_destroy(lwd); }
+
+/******************************************************************************
+ *
+ * Name              : lwd_take
+ * Alias             : lwd_tryWait
+ *
+ * Description       : try to execute the first activated lightweight task of the dispatcher,
+ *                     don't wait if there is no activated lightweight task
+ *
+ * Parameters
+ *   lwd             : pointer to lightweight task dispatcher object
+ *
+ * Return
+ *   E_SUCCESS       : lightweight task was successfully executed
+ *   E_TIMEOUT       : there is no activated lightweight task, try again
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned lwd_take( lwd_t *lwd );
+
+__STATIC_INLINE
+unsigned lwd_tryWait( lwd_t *lwd ) { return lwd_take(lwd); }
+
+/******************************************************************************
+ *
+ * Name              : lwd_waitFor
+ *
+ * Description       : wait for the activation of any lightweight task of the dispatcher for given duration of time
+ *                     and execute it to completion
+ *
+ * Parameters
+ *   lwd             : pointer to lightweight task dispatcher object
+ *   delay           : duration of time (maximum number of ticks to wait for the activation)
+ *                     IMMEDIATE: don't wait if there is no activated lightweight task
+ *                     INFINITE:  wait indefinitely for the activation
+ *
+ * Return
+ *   E_SUCCESS       : lightweight task was successfully executed
+ *   E_STOPPED       : lightweight task dispatcher object was reseted before the specified timeout expired
+ *   E_DELETED       : lightweight task dispatcher object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : no lightweight task was activated before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned lwd_waitFor( lwd_t *lwd, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : lwd_waitUntil
+ *
+ * Description       : wait for the activation of any lightweight task of the dispatcher until given timepoint
+ *                     and execute it to completion
+ *
+ * Parameters
+ *   lwd             : pointer to lightweight task dispatcher object
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : lightweight task was successfully executed
+ *   E_STOPPED       : lightweight task dispatcher object was reseted before the specified timeout expired
+ *   E_DELETED       : lightweight task dispatcher object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : no lightweight task was activated before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned lwd_waitUntil( lwd_t *lwd, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : lwd_wait
+ *
+ * Description       : wait indefinitely for the activation of any lightweight task of the dispatcher
+ *                     and execute it to completion
+ *
+ * Parameters
+ *   lwd             : pointer to lightweight task dispatcher object
+ *
+ * Return
+ *   E_SUCCESS       : lightweight task was successfully executed
+ *   E_STOPPED       : lightweight task dispatcher object was reseted
+ *   E_DELETED       : lightweight task dispatcher object was deleted
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+unsigned lwd_wait( lwd_t *lwd ) { return lwd_waitFor(lwd, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : lwt_init
+ *
+ * Description       : initialize a lightweight task object
+ *
+ * Parameters
+ *   lwt             : pointer to lightweight task object
+ *   lwd             : pointer to lightweight task dispatcher object
+ *   state           : handler of the lightweight task
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void lwt_init( lwt_t *lwt, lwd_t *lwd, act_t *state );
+
+/******************************************************************************
+ *
+ * Name              : lwt_create
+ * Alias             : lwt_new
+ *
+ * Description       : create and initialize a new lightweight task object
+ *
+ * Parameters
+ *   lwd             : pointer to lightweight task dispatcher object
+ *   state           : handler of the lightweight task
+ *
+ * Return            : pointer to lightweight task object
+ *   NULL            : object not created (not enough free memory)
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+lwt_t *lwt_create( lwd_t *lwd, act_t *state );
+
+__STATIC_INLINE
+lwt_t *lwt_new( lwd_t *lwd, act_t *state ) { return lwt_create(lwd, state); }
+
+/******************************************************************************
+ *
+ * Name              : lwt_destroy
+ * Alias             : lwt_delete
+ *
+ * Description       : cancel the activation of the lightweight task and free allocated resource
+ *
+ * Parameters
+ *   lwt             : pointer to lightweight task object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     if the handler of the lightweight task is being executed, allocated resource is freed when the handler
+ *                     is completed and activations given in the meantime are ignored
+ *
+ ******************************************************************************/
+
+void lwt_destroy( lwt_t *lwt );
+
+__STATIC_INLINE
+void lwt_delete( lwt_t *lwt ) { lwt_destroy(lwt); }
+
+/******************************************************************************
+ *
+ * Name              : lwt_give
+ * ISR alias         : lwt_giveISR
+ *
+ * Description       : activate the lightweight task with the set of events
+ *                     events of the activations are accumulated until the lightweight task is executed
+ *
+ * Parameters
+ *   lwt             : pointer to lightweight task object
+ *   sigset          : set of events (must not be zero)
+ *
+ * Return            : none
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+void lwt_give( lwt_t *lwt, unsigned sigset );
+
+__STATIC_INLINE
+void lwt_giveISR( lwt_t *lwt, unsigned sigset ) { lwt_give(lwt, sigset); }
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+
+/******************************************************************************
+ *
+ * Class             : LightweightDispatcher
+ *
+ * Description       : create and initialize a lightweight task dispatcher object
+ *
+ * Constructor parameters
+ *                   : none
+ *
+ ******************************************************************************/
+
+struct LightweightDispatcher : public __lwd
+{
+	constexpr
+	LightweightDispatcher( void ): __lwd _LWD_INIT() {}
+
+	LightweightDispatcher( LightweightDispatcher&& ) = default;
+	LightweightDispatcher( const LightweightDispatcher& ) = delete;
+	LightweightDispatcher& operator=( LightweightDispatcher&& ) = delete;
+	LightweightDispatcher& operator=( const LightweightDispatcher& ) = delete;
+
+	~LightweightDispatcher( void ) { assert(__lwd::obj.queue == nullptr && __lwd::head == nullptr); }
+
+#if __cplusplus >= 201402
+	using Ptr = std::unique_ptr<LightweightDispatcher>;
+#else
+	using Ptr = LightweightDispatcher *;
+#endif
+
+/******************************************************************************
+ *
+ * Name              : LightweightDispatcher::Create
+ *
+ * Description       : create dynamic object with manageable resources
+ *
+ * Parameters        : none
+ *
+ * Return            : std::unique_pointer / pointer to LightweightDispatcher object
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	static
+	Ptr Create( void )
+	{
+		auto lwd = new LightweightDispatcher();
+		if (lwd != nullptr)
+			lwd->__lwd::obj.res = lwd;
+		return Ptr(lwd);
+	}
+
+	void reset    ( void )           {        lwd_reset    (this); }
+	void kill     ( void )           {        lwd_kill     (this); }
+	void destroy  ( void )           {        lwd_destroy  (this); }
+	uint take     ( void )           { return lwd_take     (this); }
+	uint tryWait  ( void )           { return lwd_tryWait  (this); }
+	template<typename T>
+	uint waitFor  ( const T _delay ) { return lwd_waitFor  (this, Clock::count(_delay)); }
+	template<typename T>
+	uint waitUntil( const T _time )  { return lwd_waitUntil(this, Clock::until(_time)); }
+	uint wait     ( void )           { return lwd_wait     (this); }
+};
+
+/******************************************************************************
+ *
+ * Class             : LightweightTask
+ *
+ * Description       : create and initialize a lightweight task object
+ *
+ * Constructor parameters
+ *   lwd             : lightweight task dispatcher object
+ *   state           : handler of the lightweight task
+ *
+ ******************************************************************************/
+
+struct LightweightTask : public __lwt
+{
+	constexpr
+	LightweightTask( lwd_t &_lwd, act_t *_state ): __lwt _LWT_INIT(&_lwd, _state) {}
+
+	LightweightTask( LightweightTask&& ) = default;
+	LightweightTask( const LightweightTask& ) = delete;
+	LightweightTask& operator=( LightweightTask&& ) = delete;
+	LightweightTask& operator=( const LightweightTask& ) = delete;
+
+	~LightweightTask( void ) { assert(__lwt::sigset == 0 && !__lwt::busy); }
+
+#if __cplusplus >= 201402
+	using Ptr = std::unique_ptr<LightweightTask>;
+#else
+	using Ptr = LightweightTask *;
+#endif
+
+/******************************************************************************
+ *
+ * Name              : LightweightTask::Create
+ *
+ * Description       : create dynamic object with manageable resources
+ *
+ * Parameters
+ *   lwd             : lightweight task dispatcher object
+ *   state           : handler of the lightweight task
+ *
+ * Return            : std::unique_pointer / pointer to LightweightTask object
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	static
+	Ptr Create( lwd_t &_lwd, act_t *_state )
+	{
+		auto lwt = new LightweightTask(_lwd, _state);
+		if (lwt != nullptr)
+			lwt->__lwt::obj.res = lwt;
+		return Ptr(lwt);
+	}
+
+	void destroy  ( void )             {        lwt_destroy  (this); }
+	void give     ( unsigned _sigset ) {        lwt_give     (this, _sigset); }
+	void giveISR  ( unsigned _sigset ) {        lwt_giveISR  (this, _sigset); }
+};
+
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_LWT_H
@@ -2,7 +2,7 @@
 
     @file    StateOS: oslist.h
     @author  Rajmund Szymanski
-    @date    06.06.2020
+    @date    18.10.2026
     @brief   This file contains definitions for StateOS.
 
  ******************************************************************************
@@ -81,6 +81,7 @@ struct __lst
 	obj_t    obj;   // object header
 
 	que_t    head;  // list head
+	que_t  * tail;  // last object in the list (NULL if the list is empty)
 };
 
 /******************************************************************************
@@ -97,7 +98,7 @@ struct __lst
  *
  ******************************************************************************/
 
-#define               _LST_INIT() { _OBJ_INIT(), _QUE_INIT() }
+#define               _LST_INIT() { _OBJ_INIT(), _QUE_INIT(), NULL }
 
 /******************************************************************************
  *
@@ -0,0 +1,550 @@
+/******************************************************************************
+
+    @file    StateOS: ospipe.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOS_PIP_H
+#define __STATEOS_PIP_H
+
+#include "oskernel.h"
+#include "osclock.h"
+
+/******************************************************************************
+ *
+ * Name              : pipe
+ *                     stream buffer for a single producer and a single consumer
+ *
+ ******************************************************************************/
+
+typedef struct __pip pip_t, * const pip_id;
+
+struct __pip
+{
+	obj_t    obj;   // object header
+
+	size_t   limit; // size of the pipe buffer (in bytes)
+
+	volatile
+	unsigned head;  // position of the first element to read from data buffer (modified only by the consumer)
+	volatile
+	unsigned tail;  // position of the first element to write into data buffer (modified only by the producer)
+	char   * data;  // data buffer
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _PIP_INIT
+ *
+ * Description       : create and initialize a pipe object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of stored bytes)
+ *   data            : pipe data
+ *
+ * Return            : pipe object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _PIP_INIT( _limit, _data ) { _OBJ_INIT(), _limit, 0, 0, _data }
+
+/******************************************************************************
+ *
+ * Name              : _PIP_DATA
+ *
+ * Description       : create a pipe data
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of stored bytes)
+ *
+ * Return            : pipe data
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define               _PIP_DATA( _limit ) (char[_limit]){ 0 }
+#endif
+
+/******************************************************************************
+ *
+ * Name              : OS_PIP
+ *
+ * Description       : define and initialize a pipe object
+ *
+ * Parameters
+ *   pip             : name of a pointer to pipe object
+ *   limit           : size of a buffer (max number of stored bytes)
+ *
+ ******************************************************************************/
+
+#define             OS_PIP( pip, limit )                                \
+                       char pip##__buf[limit];                           \
+                       pip_t pip##__pip = _PIP_INIT( limit, pip##__buf ); \
+                       pip_id pip = & pip##__pip
+
+/******************************************************************************
+ *
+ * Name              : static_PIP
+ *
+ * Description       : define and initialize a static pipe object
+ *
+ * Parameters
+ *   pip             : name of a pointer to pipe object
+ *   limit           : size of a buffer (max number of stored bytes)
+ *
+ ******************************************************************************/
+
+#define         static_PIP( pip, limit )                                \
+                static char pip##__buf[limit];                           \
+                static pip_t pip##__pip = _PIP_INIT( limit, pip##__buf ); \
+                static pip_id pip = & pip##__pip
+
+/******************************************************************************
+ *
+ * Name              : PIP_INIT
+ *
+ * Description       : create and initialize a pipe object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of stored bytes)
+ *
+ * Return            : pipe object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                PIP_INIT( limit ) \
+                      _PIP_INIT( limit, _PIP_DATA( limit ) )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : PIP_CREATE
+ * Alias             : PIP_NEW
+ *
+ * Description       : create and initialize a pipe object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of stored bytes)
+ *
+ * Return            : pointer to pipe object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                PIP_CREATE( limit ) \
+           (pip_t[]) { PIP_INIT  ( limit ) }
+#define                PIP_NEW \
+                       PIP_CREATE
+#endif
+
+/******************************************************************************
+ *
+ * Name              : pip_init
+ *
+ * Description       : initialize a pipe object
+ *
+ * Parameters
+ *   pip             : pointer to pipe object
+ *   data            : pipe data
+ *   bufsize         : size of the data buffer (in bytes)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void pip_init( pip_t *pip, void *data, size_t bufsize );
+
+/******************************************************************************
+ *
+ * Name              : pip_create
+ * Alias             : pip_new
+ *
+ * Description       : create and initialize a new pipe object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of stored bytes)
+ *
+ * Return            : pointer to pipe object
+ *   NULL            : object not created (not enough free memory)
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+pip_t *pip_create( size_t limit );
+
+__STATIC_INLINE
+pip_t *pip_new( size_t limit ) { return pip_create(limit); }
+
+/******************************************************************************
+ *
+ * Name              : pip_reset
+ * Alias             : pip_kill
+ *
+ * Description       : reset the pipe object and wake up the waiting task with 'E_STOPPED' event value
+ *
+ * Parameters
+ *   pip             : pointer to pipe object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     the producer must not write into the pipe during the reset
+ *
+ ******************************************************************************/
+
+void pip_reset( pip_t *pip );
+
+__STATIC_INLINE
+void pip_kill( pip_t *pip ) { pip_reset(pip); }
+
+/******************************************************************************
+ *
+ * Name              : pip_destroy
+ * Alias             : pip_delete
+ *
+ * Description       : reset the pipe object, wake up the waiting task with 'E_DELETED' event value and free allocated resource
+ *
+ * Parameters
+ *   pip             : pointer to pipe object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     the producer must not write into the pipe during the reset
+ *
+ ******************************************************************************/
+
+void pip_destroy( pip_t *pip );
+
+__STATIC_INLINE
+void pip_delete( pip_t *pip ) { pip_destroy(pip); }
+
+/******************************************************************************
+ *
+ * Name              : pip_take
+ * Alias             : pip_tryWait
+ * ISR alias         : pip_takeISR
+ *
+ * Description       : try to transfer data from the pipe object,
+ *                     don't wait if the pipe object is empty
+ *
+ * Parameters
+ *   pip             : pointer to pipe object
+ *   data            : pointer to write buffer
+ *   size            : size of write buffer
+ *
+ * Return            : number of bytes read from the pipe or
+ *   E_TIMEOUT       : pipe object is empty, try again
+ *
+ * Note              : may be used both in thread and handler mode
+ *                     doesn't lock interrupts; use only by the consumer
+ *
+ ******************************************************************************/
+
+unsigned pip_take( pip_t *pip, void *data, unsigned size );
+
+__STATIC_INLINE
+unsigned pip_tryWait( pip_t *pip, void *data, unsigned size ) { return pip_take(pip, data, size); }
+
+__STATIC_INLINE
+unsigned pip_takeISR( pip_t *pip, void *data, unsigned size ) { return pip_take(pip, data, size); }
+
+/******************************************************************************
+ *
+ * Name              : pip_waitFor
+ *
+ * Description       : try to transfer data from the pipe object,
+ *                     wait for given duration of time while the pipe object is empty
+ *
+ * Parameters
+ *   pip             : pointer to pipe object
+ *   data            : pointer to write buffer
+ *   size            : size of write buffer
+ *   delay           : duration of time (maximum number of ticks to wait while the pipe object is empty)
+ *                     IMMEDIATE: don't wait if the pipe object is empty
+ *                     INFINITE:  wait indefinitely while the pipe object is empty
+ *
+ * Return            : number of bytes read from the pipe or
+ *   E_STOPPED       : pipe object was reseted before the specified timeout expired
+ *   E_DELETED       : pipe object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : pipe object is empty and was not received data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     locks interrupts only if the pipe object is empty; use only by the consumer
+ *
+ ******************************************************************************/
+
+unsigned pip_waitFor( pip_t *pip, void *data, unsigned size, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : pip_waitUntil
+ *
+ * Description       : try to transfer data from the pipe object,
+ *                     wait until given timepoint while the pipe object is empty
+ *
+ * Parameters
+ *   pip             : pointer to pipe object
+ *   data            : pointer to write buffer
+ *   size            : size of write buffer
+ *   time            : timepoint value
+ *
+ * Return            : number of bytes read from the pipe or
+ *   E_STOPPED       : pipe object was reseted before the specified timeout expired
+ *   E_DELETED       : pipe object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : pipe object is empty and was not received data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     locks interrupts only if the pipe object is empty; use only by the consumer
+ *
+ ******************************************************************************/
+
+unsigned pip_waitUntil( pip_t *pip, void *data, unsigned size, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : pip_wait
+ *
+ * Description       : try to transfer data from the pipe object,
+ *                     wait indefinitely while the pipe object is empty
+ *
+ * Parameters
+ *   pip             : pointer to pipe object
+ *   data            : pointer to write buffer
+ *   size            : size of write buffer
+ *
+ * Return            : number of bytes read from the pipe or
+ *   E_STOPPED       : pipe object was reseted
+ *   E_DELETED       : pipe object was deleted
+ *
+ * Note              : use only in thread mode
+ *                     locks interrupts only if the pipe object is empty; use only by the consumer
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+unsigned pip_wait( pip_t *pip, void *data, unsigned size ) { return pip_waitFor(pip, data, size, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : pip_give
+ * ISR alias         : pip_giveISR
+ *
+ * Description       : try to transfer data to the pipe object,
+ *                     don't wait if the pipe object is full
+ *
+ * Parameters
+ *   pip             : pointer to pipe object
+ *   data            : pointer to read buffer
+ *   size            : size of read buffer
+ *
+ * Return
+ *   E_SUCCESS       : data was successfully transferred to the pipe object
+ *   E_FAILURE       : size of the data is out of the limit
+ *   E_TIMEOUT       : not enough space in the pipe, try again
+ *
+ * Note              : may be used both in thread and handler mode
+ *                     locks interrupts only to wake up the waiting consumer; use only by the producer
+ *
+ ******************************************************************************/
+
+unsigned pip_give( pip_t *pip, const void *data, unsigned size );
+
+__STATIC_INLINE
+unsigned pip_giveISR( pip_t *pip, const void *data, unsigned size ) { return pip_give(pip, data, size); }
+
+/******************************************************************************
+ *
+ * Name              : pip_count
+ * ISR alias         : pip_countISR
+ *
+ * Description       : return the amount of data contained in the pipe
+ *
+ * Parameters
+ *   pip             : pointer to pipe object
+ *
+ * Return            : amount of data contained in the pipe
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+size_t pip_count( pip_t *pip );
+
+__STATIC_INLINE
+size_t pip_countISR( pip_t *pip ) { return pip_count(pip); }
+
+/******************************************************************************
+ *
+ * Name              : pip_space
+ * ISR alias         : pip_spaceISR
+ *
+ * Description       : return the amount of free space in the pipe
+ *
+ * Parameters
+ *   pip             : pointer to pipe object
+ *
+ * Return            : amount of free space in the pipe
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+size_t pip_space( pip_t *pip );
+
+__STATIC_INLINE
+size_t pip_spaceISR( pip_t *pip ) { return pip_space(pip); }
+
+/******************************************************************************
+ *
+ * Name              : pip_limit
+ * ISR alias         : pip_limitISR
+ *
+ * Description       : return the size of the pipe
+ *
+ * Parameters
+ *   pip             : pointer to pipe object
+ *
+ * Return            : size of the pipe
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+size_t pip_limit( pip_t *pip );
+
+__STATIC_INLINE
+size_t pip_limitISR( pip_t *pip ) { return pip_limit(pip); }
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+
+/******************************************************************************
+ *
+ * Class             : PipeT<>
+ *
+ * Description       : create and initialize a pipe object
+ *
+ * Constructor parameters
+ *   limit           : size of a buffer (max number of stored bytes)
+ *
+ ******************************************************************************/
+
+template<size_t limit_>
+struct PipeT : public __pip
+{
+	constexpr
+	PipeT( void ): __pip _PIP_INIT(limit_, data_) {}
+
+	PipeT( PipeT&& ) = default;
+	PipeT( const PipeT& ) = delete;
+	PipeT& operator=( PipeT&& ) = delete;
+	PipeT& operator=( const PipeT& ) = delete;
+
+	~PipeT( void ) { assert(__pip::obj.queue == nullptr); }
+
+#if __cplusplus >= 201402
+	using Ptr = std::unique_ptr<PipeT<limit_>>;
+#else
+	using Ptr = PipeT<limit_> *;
+#endif
+
+/******************************************************************************
+ *
+ * Name              : PipeT<>::Create
+ *
+ * Description       : create dynamic object with manageable resources
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of stored bytes)
+ *
+ * Return            : std::unique_pointer / pointer to PipeT<> object
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	static
+	Ptr Create( void )
+	{
+		auto pip = new PipeT<limit_>();
+		if (pip != nullptr)
+			pip->__pip::obj.res = pip;
+		return Ptr(pip);
+	}
+
+	void reset    ( void )                                              {        pip_reset    (this); }
+	void kill     ( void )                                              {        pip_kill     (this); }
+	void destroy  ( void )                                              {        pip_destroy  (this); }
+	uint take     (       void *_data, unsigned _size )                 { return pip_take     (this, _data, _size); }
+	uint tryWait  (       void *_data, unsigned _size )                 { return pip_tryWait  (this, _data, _size); }
+	uint takeISR  (       void *_data, unsigned _size )                 { return pip_takeISR  (this, _data, _size); }
+	template<typename T>
+	uint waitFor  (       void *_data, unsigned _size, const T _delay ) { return pip_waitFor  (this, _data, _size, _delay); }
+	template<typename T>
+	uint waitUntil(       void *_data, unsigned _size, const T _time )  { return pip_waitUntil(this, _data, _size, _time); }
+	uint wait     (       void *_data, unsigned _size )                 { return pip_wait     (this, _data, _size); }
+	uint give     ( const void *_data, unsigned _size )                 { return pip_give     (this, _data, _size); }
+	uint giveISR  ( const void *_data, unsigned _size )                 { return pip_giveISR  (this, _data, _size); }
+	size_t count  ( void )                                              { return pip_count    (this); }
+	size_t countISR( void )                                             { return pip_countISR (this); }
+	size_t space  ( void )                                              { return pip_space    (this); }
+	size_t spaceISR( void )                                             { return pip_spaceISR (this); }
+	size_t limit  ( void )                                              { return pip_limit    (this); }
+	size_t limitISR( void )                                             { return pip_limitISR (this); }
+
+	private:
+	char data_[limit_];
+};
+
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_PIP_H
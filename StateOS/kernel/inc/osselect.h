@@ -0,0 +1,303 @@
+/******************************************************************************
+
+    @file    StateOS: osselect.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOS_SEL_H
+#define __STATEOS_SEL_H
+
+#include "oskernel.h"
+#include "osclock.h"
+#include "osflag.h"
+#include "ossemaphore.h"
+#include "osstreambuffer.h"
+#include "osmessagebuffer.h"
+#include "osmailboxqueue.h"
+#include "oseventqueue.h"
+
+/******************************************************************************
+ *
+ * Name              : wait for multiple objects (select)
+ *
+ ******************************************************************************/
+
+#define selSemaphore     ( 0U ) // semaphore is ready when its counter is not zero
+#define selStreamBuffer  ( 1U ) // stream buffer is ready when it is not empty
+#define selMessageBuffer ( 2U ) // message buffer is ready when it is not empty
+#define selMailboxQueue  ( 3U ) // mailbox queue is ready when it is not empty
+#define selEventQueue    ( 4U ) // event queue is ready when it is not empty
+#define selFlag          ( 5U ) // flag object is ready when any of the expected flags is set
+
+typedef struct __sel sel_t;
+
+struct __sel
+{
+	void   * obj;   // pointer to the supervised object
+	unsigned type;  // type of the supervised object
+	unsigned flags; // expected flags (flag object only)
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _SEL_INIT
+ *
+ * Description       : create and initialize a select descriptor
+ *
+ * Parameters
+ *   obj             : pointer to the supervised object
+ *   type            : type of the supervised object
+ *   flags           : expected flags (flag object only)
+ *
+ * Return            : select descriptor
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _SEL_INIT( _obj, _type, _flags ) { _obj, _type, _flags }
+
+/******************************************************************************
+ *
+ * Name              : SEL_SEM
+ * Name              : SEL_STM
+ * Name              : SEL_MSG
+ * Name              : SEL_BOX
+ * Name              : SEL_EVQ
+ * Name              : SEL_FLG
+ *
+ * Description       : create and initialize a select descriptor of the given object
+ *
+ * Parameters
+ *   sem             : pointer to semaphore object
+ *   stm             : pointer to stream buffer object
+ *   msg             : pointer to message buffer object
+ *   box             : pointer to mailbox queue object
+ *   evq             : pointer to event queue object
+ *   flg             : pointer to flag object
+ *   flags           : expected flags
+ *
+ * Return            : select descriptor
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                SEL_SEM( sem )        _SEL_INIT( (sem_t *)(sem), selSemaphore,     0 )
+#define                SEL_STM( stm )        _SEL_INIT( (stm_t *)(stm), selStreamBuffer,  0 )
+#define                SEL_MSG( msg )        _SEL_INIT( (msg_t *)(msg), selMessageBuffer, 0 )
+#define                SEL_BOX( box )        _SEL_INIT( (box_t *)(box), selMailboxQueue,  0 )
+#define                SEL_EVQ( evq )        _SEL_INIT( (evq_t *)(evq), selEventQueue,    0 )
+#define                SEL_FLG( flg, flags ) _SEL_INIT( (flg_t *)(flg), selFlag,      flags )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : sel_take
+ * Alias             : sel_tryWait
+ * ISR alias         : sel_takeISR
+ *
+ * Description       : check if any of the supervised objects is ready,
+ *                     don't wait if none of them is ready
+ *
+ * Parameters
+ *   sel             : pointer to the table of select descriptors
+ *   count           : number of select descriptors
+ *
+ * Return
+ *   index           : index of the first ready object in the table
+ *   E_TIMEOUT       : none of the supervised objects is ready
+ *
+ * Note              : may be used both in thread and handler mode
+ *                     ready object is not taken, use the take function of the object for it
+ *
+ ******************************************************************************/
+
+unsigned sel_take( const sel_t *sel, unsigned count );
+
+__STATIC_INLINE
+unsigned sel_tryWait( const sel_t *sel, unsigned count ) { return sel_take(sel, count); }
+
+__STATIC_INLINE
+unsigned sel_takeISR( const sel_t *sel, unsigned count ) { return sel_take(sel, count); }
+
+/******************************************************************************
+ *
+ * Name              : sel_waitFor
+ *
+ * Description       : wait for any of the supervised objects to become ready for given duration of time
+ *
+ * Parameters
+ *   sel             : pointer to the table of select descriptors
+ *   count           : number of select descriptors
+ *   delay           : duration of time (maximum number of ticks to wait for any of the supervised objects)
+ *                     IMMEDIATE: don't wait if none of the supervised objects is ready
+ *                     INFINITE:  wait indefinitely until any of the supervised objects becomes ready
+ *
+ * Return
+ *   index           : index of the object in the table that has become ready
+ *   E_TIMEOUT       : none of the supervised objects has become ready before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     ready object is not taken, use the take function of the object for it
+ *
+ ******************************************************************************/
+
+unsigned sel_waitFor( const sel_t *sel, unsigned count, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : sel_waitUntil
+ *
+ * Description       : wait for any of the supervised objects to become ready until given timepoint
+ *
+ * Parameters
+ *   sel             : pointer to the table of select descriptors
+ *   count           : number of select descriptors
+ *   time            : timepoint value
+ *
+ * Return
+ *   index           : index of the object in the table that has become ready
+ *   E_TIMEOUT       : none of the supervised objects has become ready before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     ready object is not taken, use the take function of the object for it
+ *
+ ******************************************************************************/
+
+unsigned sel_waitUntil( const sel_t *sel, unsigned count, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : sel_wait
+ *
+ * Description       : wait indefinitely until any of the supervised objects becomes ready
+ *
+ * Parameters
+ *   sel             : pointer to the table of select descriptors
+ *   count           : number of select descriptors
+ *
+ * Return
+ *   index           : index of the object in the table that has become ready
+ *
+ * Note              : use only in thread mode
+ *                     ready object is not taken, use the take function of the object for it
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+unsigned sel_wait( const sel_t *sel, unsigned count ) { return sel_waitFor(sel, count, INFINITE); }
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+
+#include <initializer_list>
+
+/******************************************************************************
+ *
+ * Class             : SelectItem
+ *
+ * Description       : create and initialize a select descriptor
+ *
+ * Constructor parameters
+ *   obj             : pointer / reference to the supervised object
+ *   flags           : expected flags (flag object only)
+ *
+ ******************************************************************************/
+
+struct SelectItem : public __sel
+{
+	constexpr
+	SelectItem( sem_t *_sem ):                  __sel _SEL_INIT(_sem, selSemaphore,     0) {}
+	constexpr
+	SelectItem( sem_t &_sem ):                  __sel _SEL_INIT(&_sem, selSemaphore,     0) {}
+	constexpr
+	SelectItem( stm_t *_stm ):                  __sel _SEL_INIT(_stm, selStreamBuffer,  0) {}
+	constexpr
+	SelectItem( stm_t &_stm ):                  __sel _SEL_INIT(&_stm, selStreamBuffer,  0) {}
+	constexpr
+	SelectItem( msg_t *_msg ):                  __sel _SEL_INIT(_msg, selMessageBuffer, 0) {}
+	constexpr
+	SelectItem( msg_t &_msg ):                  __sel _SEL_INIT(&_msg, selMessageBuffer, 0) {}
+	constexpr
+	SelectItem( box_t *_box ):                  __sel _SEL_INIT(_box, selMailboxQueue,  0) {}
+	constexpr
+	SelectItem( box_t &_box ):                  __sel _SEL_INIT(&_box, selMailboxQueue,  0) {}
+	constexpr
+	SelectItem( evq_t *_evq ):                  __sel _SEL_INIT(_evq, selEventQueue,    0) {}
+	constexpr
+	SelectItem( evq_t &_evq ):                  __sel _SEL_INIT(&_evq, selEventQueue,    0) {}
+	constexpr
+	SelectItem( flg_t *_flg, unsigned _flags ): __sel _SEL_INIT(_flg, selFlag,     _flags) {}
+	constexpr
+	SelectItem( flg_t &_flg, unsigned _flags ): __sel _SEL_INIT(&_flg, selFlag,     _flags) {}
+};
+
+/******************************************************************************
+ *
+ * Class             : Select
+ *
+ * Description       : wait for multiple objects
+ *
+ * Note              : functions return the index of the ready object in the list or E_TIMEOUT
+ *
+ ******************************************************************************/
+
+struct Select
+{
+	using List = std::initializer_list<SelectItem>;
+
+	static
+	uint take     ( List _list )                 { return sel_take     (_list.begin(), _list.size()); }
+	static
+	uint tryWait  ( List _list )                 { return sel_tryWait  (_list.begin(), _list.size()); }
+	static
+	uint takeISR  ( List _list )                 { return sel_takeISR  (_list.begin(), _list.size()); }
+	template<typename T> static
+	uint waitFor  ( List _list, const T _delay ) { return sel_waitFor  (_list.begin(), _list.size(), Clock::count(_delay)); }
+	template<typename T> static
+	uint waitUntil( List _list, const T _time )  { return sel_waitUntil(_list.begin(), _list.size(), Clock::until(_time)); }
+	static
+	uint wait     ( List _list )                 { return sel_wait     (_list.begin(), _list.size()); }
+};
+
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_SEL_H
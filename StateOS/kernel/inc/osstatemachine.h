@@ -0,0 +1,476 @@
+/******************************************************************************
+
+    @file    StateOS: osstatemachine.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOS_HSM_H
+#define __STATEOS_HSM_H
+
+#include "oskernel.h"
+#include "osclock.h"
+#include "oseventqueue.h"
+#include "osactiveobject.h"
+
+/* -------------------------------------------------------------------------- */
+
+#if defined(__cplusplus) && (__cplusplus >= 201402)
+
+#define hsmNone      ( ~0U ) // no state / no transition
+
+/******************************************************************************
+ *
+ * Name              : HsmState<>
+ *
+ * Description       : state of the hierarchical state machine
+ *
+ * Fields
+ *   parent          : index of the superstate, hsmNone: top-level state
+ *   initial         : index of the initial substate, hsmNone: leaf state
+ *   entry           : entry action of the state, nullptr: none
+ *   exit            : exit action of the state, nullptr: none
+ *
+ * Note              : the state is identified by its index in the table of states
+ *
+ ******************************************************************************/
+
+template<class C>
+struct HsmState
+{
+	unsigned parent  = hsmNone;
+	unsigned initial = hsmNone;
+	void  (* entry )( C & ) = nullptr;
+	void  (* exit  )( C & ) = nullptr;
+};
+
+/******************************************************************************
+ *
+ * Name              : HsmTransition<>
+ *
+ * Description       : transition of the hierarchical state machine
+ *
+ * Fields
+ *   source          : index of the source state
+ *   signal          : signal triggering the transition
+ *   target          : index of the target state, hsmNone: internal transition (no exit / entry actions)
+ *   action          : action of the transition, nullptr: none
+ *   guard           : guard condition of the transition, nullptr: none
+ *
+ * Note              : the transition of the source state is inherited by all its substates
+ *                     if the guard condition is false, the next transition of the same signal
+ *                     is taken (the next one of the source state or the first one of its superstates)
+ *                     transition to the substate of the source state does not exit the source state (local transition)
+ *                     self-transition and transition to the superstate of the source state exit and reenter the target state
+ *
+ ******************************************************************************/
+
+template<class C>
+struct HsmTransition
+{
+	unsigned source = hsmNone;
+	unsigned signal = 0;
+	unsigned target = hsmNone;
+	void  (* action )( C &, const aev_t * ) = nullptr;
+	bool  (* guard  )( C &, const aev_t * ) = nullptr;
+};
+
+/******************************************************************************
+ *
+ * Class             : HsmTableT<>
+ *
+ * Description       : create and resolve the transition table of the hierarchical state machine
+ *
+ * Constructor parameters
+ *   states          : table of states
+ *   transitions     : table of transitions
+ *   initial         : index of the initial state
+ *
+ * Note              : the object should be declared as constexpr; then the tables are verified
+ *                     and all the transitions are resolved at compile time:
+ *                     - the transition handling each signal in each state (inherited from the superstates),
+ *                     - the least common ancestor of the source and target states (end of the exit path),
+ *                     - the leaf state entered through the initial substates of the target state
+ *                     dispatching of the event is then a single table lookup
+ *
+ ******************************************************************************/
+
+template<class C, unsigned states_, unsigned transitions_, unsigned signals_>
+struct HsmTableT
+{
+	using Context    = C;
+	using State      = HsmState<C>;
+	using Transition = HsmTransition<C>;
+
+	static constexpr unsigned signals = signals_;
+
+	constexpr
+	HsmTableT( const State (&_states)[states_], const Transition (&_transitions)[transitions_], unsigned _initial )
+	{
+		for (unsigned s = 0; s < states_; s++)
+		{
+			assert(_states[s].parent == hsmNone || _states[s].parent < states_);
+			state_[s] = _states[s];
+		}
+
+		for (unsigned s = 0; s < states_; s++)
+		{
+			depth_[s] = priv_depth(s);
+			assert(state_[s].initial == hsmNone || state_[state_[s].initial].parent == s);
+		}
+
+		for (unsigned t = 0; t < transitions_; t++)
+		{
+			assert(_transitions[t].source < states_);
+			assert(_transitions[t].signal < signals_);
+			assert(_transitions[t].target == hsmNone || _transitions[t].target < states_);
+			trans_[t] = _transitions[t];
+		}
+
+		for (unsigned t = 0; t < transitions_; t++)
+		{
+			next_[t] = priv_lookup(trans_[t].source, trans_[t].signal, t + 1);
+			if (trans_[t].target != hsmNone)
+			{
+				lca_ [t] = priv_lca(trans_[t].source, trans_[t].target);
+				leaf_[t] = priv_leaf(trans_[t].target);
+			}
+		}
+
+		for (unsigned s = 0; s < states_; s++)
+			for (unsigned e = 0; e < signals_; e++)
+				cell_[s][e] = priv_lookup(s, e, 0);
+
+		assert(_initial < states_);
+		initial_ = priv_leaf(_initial);
+	}
+
+	private:
+
+	template<class>
+	friend struct StateMachineT;
+
+//	number of superstates of the state; the tree of states must not contain any cycle
+	constexpr unsigned priv_depth( unsigned _state ) const
+	{
+		unsigned depth = 0;
+		while (_state = state_[_state].parent, _state != hsmNone)
+		{
+			depth++;
+			assert(depth < states_);
+		}
+		return depth;
+	}
+
+//	leaf state entered through the initial substates
+	constexpr unsigned priv_leaf( unsigned _state ) const
+	{
+		while (state_[_state].initial != hsmNone)
+			_state = state_[_state].initial;
+		return _state;
+	}
+
+//	check if the state is the given superstate or any of its substates
+	constexpr bool priv_isIn( unsigned _state, unsigned _super ) const
+	{
+		for (; _state != hsmNone; _state = state_[_state].parent)
+			if (_state == _super)
+				return true;
+		return _super == hsmNone;
+	}
+
+//	least common ancestor of the source and target states; the target state itself is always entered
+	constexpr unsigned priv_lca( unsigned _source, unsigned _target ) const
+	{
+		while (_source != hsmNone && (_source == _target || !priv_isIn(_target, _source)))
+			_source = state_[_source].parent;
+		return _source;
+	}
+
+//	first transition of the signal in the state (starting from the given transition) or in its superstates
+	constexpr unsigned priv_lookup( unsigned _state, unsigned _signal, unsigned _first ) const
+	{
+		for (; _state != hsmNone; _state = state_[_state].parent, _first = 0)
+			for (unsigned t = _first; t < transitions_; t++)
+				if (trans_[t].source == _state && trans_[t].signal == _signal)
+					return t;
+		return hsmNone;
+	}
+
+	State      state_[states_] {};
+	Transition trans_[transitions_] {};
+	unsigned   depth_[states_] {};
+	unsigned   next_ [transitions_] {};
+	unsigned   lca_  [transitions_] {};
+	unsigned   leaf_ [transitions_] {};
+	unsigned   cell_ [states_][signals_] {};
+	unsigned   initial_ = hsmNone;
+};
+
+/******************************************************************************
+ *
+ * Name              : HsmTable
+ *
+ * Description       : create and resolve the transition table of the hierarchical state machine
+ *
+ * Parameters
+ *   signals         : number of signals (template parameter)
+ *   states          : table of states
+ *   transitions     : table of transitions
+ *   initial         : index of the initial state
+ *
+ * Return            : HsmTableT<> object
+ *
+ * Note              : sizes of the tables are deduced
+ *
+ ******************************************************************************/
+
+template<unsigned signals_, class C, unsigned states_, unsigned transitions_>
+constexpr
+HsmTableT<C, states_, transitions_, signals_> HsmTable( const HsmState<C> (&_states)[states_], const HsmTransition<C> (&_transitions)[transitions_], unsigned _initial )
+{
+	return HsmTableT<C, states_, transitions_, signals_>(_states, _transitions, _initial);
+}
+
+/******************************************************************************
+ *
+ * Class             : StateMachineT<>
+ *
+ * Description       : create a hierarchical state machine
+ *
+ * Constructor parameters
+ *   table           : resolved transition table (HsmTableT<> object)
+ *   context         : extended state, passed to all the actions and guards
+ *
+ * Note              : events are handled to completion, the actions must not dispatch any event to the same state machine;
+ *                     new events should be posted to the event queue (or to the active object) instead
+ *                     events of the signals not handled in the current state are discarded
+ *
+ ******************************************************************************/
+
+template<class H>
+struct StateMachineT
+{
+	using Context = typename H::Context;
+
+	constexpr
+	StateMachineT( const H &_table, Context &_context ): table_(_table), ctx_(_context) {}
+
+	StateMachineT( StateMachineT&& ) = default;
+	StateMachineT( const StateMachineT& ) = delete;
+	StateMachineT& operator=( StateMachineT&& ) = delete;
+	StateMachineT& operator=( const StateMachineT& ) = delete;
+
+/******************************************************************************
+ *
+ * Name              : start
+ *
+ * Description       : enter the initial state, execute entry actions of all the states from the top-level state down to the leaf state
+ *
+ ******************************************************************************/
+
+	void start( void )
+	{
+		assert(cur_ == hsmNone);
+
+		priv_enter(hsmNone, table_.initial_);
+		cur_ = table_.initial_;
+	}
+
+/******************************************************************************
+ *
+ * Name              : dispatch
+ *
+ * Description       : handle the event in the current state to completion
+ *
+ * Parameters
+ *   aev / signal    : pointer to the active event / signal of the event
+ *
+ ******************************************************************************/
+
+	void dispatch( const aev_t *_aev )
+	{
+		unsigned t;
+
+		assert(_aev);
+		assert(cur_ != hsmNone);
+
+		if (_aev->signal >= H::signals)
+			return;
+
+		t = table_.cell_[cur_][_aev->signal];
+		while (t != hsmNone && table_.trans_[t].guard != nullptr && !table_.trans_[t].guard(ctx_, _aev))
+			t = table_.next_[t];
+		if (t == hsmNone)
+			return;
+
+		const HsmTransition<Context> &tr = table_.trans_[t];
+
+		if (tr.target == hsmNone)
+		{
+			if (tr.action != nullptr)
+				tr.action(ctx_, _aev);
+			return;
+		}
+
+		priv_exit(table_.lca_[t]);
+		if (tr.action != nullptr)
+			tr.action(ctx_, _aev);
+		priv_enter(table_.lca_[t], table_.leaf_[t]);
+		cur_ = table_.leaf_[t];
+	}
+
+	void dispatch( unsigned _signal )
+	{
+		const ActiveEvent aev(_signal);
+		dispatch(&aev);
+	}
+
+/******************************************************************************
+ *
+ * Name              : state
+ *
+ * Description       : get the current (leaf) state
+ *
+ * Return            : index of the current state, hsmNone: the state machine has not been started
+ *
+ ******************************************************************************/
+
+	unsigned state( void ) const { return cur_; }
+
+/******************************************************************************
+ *
+ * Name              : isIn
+ *
+ * Description       : check if the current state is the given state or any of its substates
+ *
+ * Parameters
+ *   state           : index of the state
+ *
+ * Return            : true if the state is active
+ *
+ ******************************************************************************/
+
+	bool isIn( unsigned _state ) const { return cur_ != hsmNone && table_.priv_isIn(cur_, _state); }
+
+/******************************************************************************
+ *
+ * Name              : take / tryWait / waitFor / waitUntil / wait
+ *
+ * Description       : get the signal from the event queue and dispatch it to the state machine
+ *
+ * Parameters
+ *   evq             : event queue object
+ *   delay / time    : timeout (see evq_waitFor / evq_waitUntil)
+ *
+ * Return            : E_SUCCESS if the event has been dispatched, otherwise the result of the event queue function
+ *
+ ******************************************************************************/
+
+	uint take     ( evq_t &_evq )                   { unsigned s; return priv_dispatch(evq_take     (&_evq, &s), &s); }
+	uint tryWait  ( evq_t &_evq )                   { unsigned s; return priv_dispatch(evq_tryWait  (&_evq, &s), &s); }
+	template<typename T>
+	uint waitFor  ( evq_t &_evq, const T _delay )   { unsigned s; return priv_dispatch(evq_waitFor  (&_evq, &s, Clock::count(_delay)), &s); }
+	template<typename T>
+	uint waitUntil( evq_t &_evq, const T _time )    { unsigned s; return priv_dispatch(evq_waitUntil(&_evq, &s, Clock::until(_time)), &s); }
+	uint wait     ( evq_t &_evq )                   { unsigned s; return priv_dispatch(evq_wait     (&_evq, &s), &s); }
+
+	private:
+
+//	the signal is read after the event queue function has returned
+	uint priv_dispatch( uint _event, const unsigned *_signal )
+	{
+		if (_event == E_SUCCESS)
+			dispatch(*_signal);
+		return _event;
+	}
+
+//	execute exit actions from the current state up to the given superstate (exclusive)
+	void priv_exit( unsigned _lca )
+	{
+		for (unsigned s = cur_; s != _lca; s = table_.state_[s].parent)
+			if (table_.state_[s].exit != nullptr)
+				table_.state_[s].exit(ctx_);
+	}
+
+//	execute entry actions from the given superstate (exclusive) down to the leaf state
+	void priv_enter( unsigned _lca, unsigned _leaf )
+	{
+		unsigned level = _lca == hsmNone ? 0 : table_.depth_[_lca] + 1;
+		for (; level <= table_.depth_[_leaf]; level++)
+		{
+			unsigned s = _leaf;
+			while (table_.depth_[s] > level)
+				s = table_.state_[s].parent;
+			if (table_.state_[s].entry != nullptr)
+				table_.state_[s].entry(ctx_);
+		}
+	}
+
+	const H &table_;
+	Context &ctx_;
+	unsigned cur_ = hsmNone;
+};
+
+/******************************************************************************
+ *
+ * Class             : ActiveStateMachineT<>
+ *
+ * Description       : create a hierarchical state machine driven by the active object
+ *
+ * Constructor parameters
+ *   table           : resolved transition table (HsmTableT<> object)
+ *   context         : extended state, passed to all the actions and guards
+ *   limit           : size of the event queue (max number of stored events)
+ *
+ * Note              : events posted to the active object are dispatched to the state machine
+ *                     by the task waiting for the active object (take, waitFor, waitUntil, wait)
+ *                     the state machine must be started before the first event is handled
+ *
+ ******************************************************************************/
+
+template<class H, unsigned limit_>
+struct ActiveStateMachineT : public ActiveObjectT<limit_>, public StateMachineT<H>
+{
+	constexpr
+	ActiveStateMachineT( const H &_table, typename H::Context &_context ): ActiveObjectT<limit_>(handler_), StateMachineT<H>(_table, _context) {}
+
+	using ActiveObjectT<limit_>::take;
+	using ActiveObjectT<limit_>::tryWait;
+	using ActiveObjectT<limit_>::waitFor;
+	using ActiveObjectT<limit_>::waitUntil;
+	using ActiveObjectT<limit_>::wait;
+
+	private:
+	static void handler_( aob_t *_aob, const aev_t *_aev ) { static_cast<ActiveStateMachineT *>(_aob)->dispatch(_aev); }
+};
+
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_HSM_H
@@ -2,7 +2,7 @@
 
     @file    StateOS: osstreambuffer.h
     @author  Rajmund Szymanski
-    @date    09.06.2020
+    @date    18.10.2026
     @brief   This file contains definitions for StateOS.
 
  ******************************************************************************
@@ -506,6 +506,109 @@ unsigned stm_push( stm_t *stm, const void *data, unsigned size );
 __STATIC_INLINE
 unsigned stm_pushISR( stm_t *stm, const void *data, unsigned size ) { return stm_push(stm, data, size); }
 
+/******************************************************************************
+ *
+ * Name              : stm_reserve
+ * ISR alias         : stm_reserveISR
+ *
+ * Description       : try to reserve contiguous free space at the end of the data of the stream buffer object,
+ *                     don't wait if the stream buffer object is full
+ *
+ * Parameters
+ *   stm             : pointer to stream buffer object
+ *   data            : pointer to the variable receiving the address of the reserved space
+ *   size            : requested size of the reserved space
+ *
+ * Return            : size of the reserved space (not greater than the requested size) or
+ *   E_TIMEOUT       : stream buffer object is full or other tasks are waiting to write, try again
+ *
+ * Note              : may be used both in thread and handler mode
+ *                     the reserved space can be written directly (e.g. by DMA), then it must be passed to stm_commit
+ *                     other data must not be written into the stream buffer until the reservation is committed
+ *
+ ******************************************************************************/
+
+unsigned stm_reserve( stm_t *stm, void **data, unsigned size );
+
+__STATIC_INLINE
+unsigned stm_reserveISR( stm_t *stm, void **data, unsigned size ) { return stm_reserve(stm, data, size); }
+
+/******************************************************************************
+ *
+ * Name              : stm_commit
+ * ISR alias         : stm_commitISR
+ *
+ * Description       : append data written into the space reserved with stm_reserve to the stream buffer object
+ *                     and transfer data to the waiting tasks
+ *
+ * Parameters
+ *   stm             : pointer to stream buffer object
+ *   size            : size of the written data (not greater than the size of the reserved space)
+ *
+ * Return
+ *   E_SUCCESS       : stream data was successfully appended to the stream buffer object
+ *   E_FAILURE       : size of the stream data is out of the reserved space
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+unsigned stm_commit( stm_t *stm, unsigned size );
+
+__STATIC_INLINE
+unsigned stm_commitISR( stm_t *stm, unsigned size ) { return stm_commit(stm, size); }
+
+/******************************************************************************
+ *
+ * Name              : stm_peek
+ * ISR alias         : stm_peekISR
+ *
+ * Description       : try to get contiguous data from the beginning of the stream buffer object,
+ *                     don't wait if the stream buffer object is empty
+ *
+ * Parameters
+ *   stm             : pointer to stream buffer object
+ *   data            : pointer to the variable receiving the address of the data
+ *
+ * Return            : size of the contiguous data available at the received address or
+ *   E_TIMEOUT       : stream buffer object is empty, try again
+ *
+ * Note              : may be used both in thread and handler mode
+ *                     the data can be read directly, then it must be removed with stm_consume
+ *                     other data must not be read from the stream buffer until the data is consumed
+ *
+ ******************************************************************************/
+
+unsigned stm_peek( stm_t *stm, void **data );
+
+__STATIC_INLINE
+unsigned stm_peekISR( stm_t *stm, void **data ) { return stm_peek(stm, data); }
+
+/******************************************************************************
+ *
+ * Name              : stm_consume
+ * ISR alias         : stm_consumeISR
+ *
+ * Description       : remove data from the beginning of the stream buffer object
+ *                     and transfer data from the waiting tasks
+ *
+ * Parameters
+ *   stm             : pointer to stream buffer object
+ *   size            : size of the removed data
+ *
+ * Return
+ *   E_SUCCESS       : stream data was successfully removed from the stream buffer object
+ *   E_FAILURE       : size of the stream data is out of the amount of data contained in the stream buffer
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+unsigned stm_consume( stm_t *stm, unsigned size );
+
+__STATIC_INLINE
+unsigned stm_consumeISR( stm_t *stm, unsigned size ) { return stm_consume(stm, size); }
+
 /******************************************************************************
  *
  * Name              : stm_count
@@ -651,6 +754,14 @@ struct StreamBufferT : public __stm
 	uint send     ( const void *_data, unsigned _size )                 { return stm_send     (this, _data, _size); }
 	uint push     ( const void *_data, unsigned _size )                 { return stm_push     (this, _data, _size); }
 	uint pushISR  ( const void *_data, unsigned _size )                 { return stm_pushISR  (this, _data, _size); }
+	uint reserve  (      void **_data, unsigned _size )                 { return stm_reserve  (this, _data, _size); }
+	uint reserveISR(     void **_data, unsigned _size )                 { return stm_reserveISR(this, _data, _size); }
+	uint commit   ( unsigned _size )                                    { return stm_commit   (this, _size); }
+	uint commitISR( unsigned _size )                                    { return stm_commitISR(this, _size); }
+	uint peek     (      void **_data )                                 { return stm_peek     (this, _data); }
+	uint peekISR  (      void **_data )                                 { return stm_peekISR  (this, _data); }
+	uint consume  ( unsigned _size )                                    { return stm_consume  (this, _size); }
+	uint consumeISR( unsigned _size )                                   { return stm_consumeISR(this, _size); }
 	size_t count  ( void )                                              { return stm_count    (this); }
 	size_t countISR( void )                                             { return stm_countISR (this); }
 	size_t space  ( void )                                              { return stm_space    (this); }
@@ -2,7 +2,7 @@
 
     @file    StateOS: ostask.h
     @author  Rajmund Szymanski
-    @date    09.06.2020
+    @date    18.10.2026
     @brief   This file contains definitions for StateOS.
 
  ******************************************************************************
@@ -40,10 +40,10 @@
 /* -------------------------------------------------------------------------- */
 
 #define STK_SIZE( size ) \
-    ALIGNED_SIZE(( size ) + (OS_GUARD_SIZE), sizeof( stk_t ))
+    ALIGNED_SIZE(( size ) + (OS_GUARD_SIZE) + (OS_FRAME_SIZE), sizeof( stk_t ))
 
 #define STK_OVER( size ) \
-         ALIGNED(( size ) + (OS_GUARD_SIZE), sizeof( stk_t ))
+         ALIGNED(( size ) + (OS_GUARD_SIZE) + (OS_FRAME_SIZE), sizeof( stk_t ))
 
 #define STK_CROP( base, size ) \
          LIMITED((uintptr_t)( base ) + (size_t)( size ), sizeof( stk_t ))
@@ -73,6 +73,7 @@ struct __tsk
 
 	tsk_t  * owner; // task owner (joinable / detached state)
 	tsk_t ** guard; // BLOCKED queue for the pending process
+	unsigned count; // count of tasks in the BLOCKED queue (kept by the first task of the queue)
 
 	unsigned event; // wakeup event
 
@@ -89,6 +90,12 @@ struct __tsk
 	tsk_t ** guard;
 	}        backup;
 	}        sig;
+#if OS_TASK_STATS
+	uint64_t time;  // run time of the task, in cycles of the cycle counter (CYC_FREQUENCY)
+	#define _TSK_STATS 0,
+#else
+	#define _TSK_STATS
+#endif
 
 	union  {
 
@@ -153,6 +160,16 @@ struct __tsk
 	}        data;
 	}        job;   // temporary data used by job queue object
 
+	struct {
+	mtx_t  * mtx;
+	}        cnd;   // temporary data used by condition variable object
+
+	struct {
+	const
+	struct __sel * list;
+	unsigned count;
+	}        sel;   // temporary data used by wait for multiple objects
+
 	}        tmp;
 #if defined(__ARMCC_VERSION) && !defined(__MICROLIB)
 	char     libspace[96];
@@ -185,9 +202,9 @@ extern "C" {
  *
  ******************************************************************************/
 
-#define               _TSK_INIT( _prio, _state, _stack, _size )                                               \
-                       { _HDR_INIT(), _state, 0, 0, 0, NULL, _stack, _size, NULL, _prio, _prio, NULL, NULL, 0, \
-                       { NULL, NULL }, { 0, NULL, { NULL, NULL } }, { { NULL } }, _TSK_EXTRA }
+#define               _TSK_INIT( _prio, _state, _stack, _size )                                                   \
+                       { _HDR_INIT(), _state, 0, 0, 0, NULL, _stack, _size, NULL, _prio, _prio, NULL, NULL, 0, 0, \
+                       { NULL, NULL }, { 0, NULL, { NULL, NULL } }, _TSK_STATS { { NULL } }, _TSK_EXTRA }
 
 /******************************************************************************
  *
@@ -1327,6 +1344,46 @@ size_t tsk_stackSpace( void )
 #endif
 }
 
+/******************************************************************************
+ *
+ * Name              : tsk_getRunTime
+ *
+ * Description       : get the run time of the task (time spent by the processor executing the task)
+ *
+ * Parameters
+ *   tsk             : pointer to task object
+ *
+ * Return            : run time of the task, in cycles of the cycle counter (CYC_FREQUENCY)
+ *   0               : OS_TASK_STATS not defined
+ *
+ * Note              : may be used both in thread and handler mode
+ *                     the run time of the task is updated at every context switch and at every tick of the system timer (non-tick-less mode only)
+ *                     interrupt handlers are accounted to the interrupted task
+ *
+ ******************************************************************************/
+
+uint64_t tsk_getRunTime( tsk_t *tsk );
+
+__STATIC_INLINE
+uint64_t cur_getRunTime( void ) { return tsk_getRunTime(System.cur); }
+
+/******************************************************************************
+ *
+ * Name              : sys_getLoad
+ *
+ * Description       : get the processor load (time spent outside the idle task) since the previous call of the function
+ *
+ * Parameters        : none
+ *
+ * Return            : processor load in percent (0..100)
+ *   0               : OS_TASK_STATS not defined
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+unsigned sys_getLoad( void );
+
 #ifdef __cplusplus
 }
 #endif
@@ -1400,6 +1457,8 @@ struct baseTask : public __tsk
 	uint destroy  ( void )             { return tsk_destroy  (this); }
 	uint prio     ( void )             { return __tsk::basic; }
 	uint getPrio  ( void )             { return __tsk::basic; }
+	uint64_t
+	     getRunTime( void )            { return tsk_getRunTime(this); }
 	uint suspend  ( void )             { return tsk_suspend  (this); }
 	uint resume   ( void )             { return tsk_resume   (this); }
 	uint resumeISR( void )             { return tsk_resumeISR(this); }
@@ -1476,6 +1535,9 @@ struct baseTask : public __tsk
 		uint getPrio   ( void )             { return tsk_getPrio   (); }
 		static
 		uint prio      ( void )             { return tsk_getPrio   (); }
+		static
+		uint64_t
+		     getRunTime( void )             { return cur_getRunTime(); }
 		template<typename T> static
 		void sleepFor  ( const T  _delay )  {        tsk_sleepFor  (Clock::count(_delay)); }
 		template<typename T> static
@@ -2,7 +2,7 @@
 
     @file    StateOS: ostimer.h
     @author  Rajmund Szymanski
-    @date    07.06.2020
+    @date    18.10.2026
     @brief   This file contains definitions for StateOS.
 
  ******************************************************************************
@@ -49,6 +49,8 @@ struct __tmr
 	cnt_t    start;
 	cnt_t    delay;
 	cnt_t    period;
+	cnt_t    slack; // tolerance of the expiration time
+	cnt_t    shift; // delay of the current expiration within the tolerance
 };
 
 #ifdef __cplusplus
@@ -72,7 +74,7 @@ extern "C" {
  ******************************************************************************/
 
 #define               _TMR_INIT( _state ) \
-                    { _HDR_INIT(), _state, 0, 0, 0 }
+                    { _HDR_INIT(), _state, 0, 0, 0, 0, 0 }
 
 /******************************************************************************
  *
@@ -311,7 +313,11 @@ extern "C" {
  ******************************************************************************/
 
 __STATIC_INLINE
+#if OS_TIMER_TASK
+tmr_t *tmr_thisISR( void ) { return System.tmr; }
+#else
 tmr_t *tmr_thisISR( void ) { return (tmr_t *) WAIT.hdr.next; }
+#endif
 
 /******************************************************************************
  *
@@ -494,6 +500,37 @@ void tmr_startPeriodic( tmr_t *tmr, cnt_t period ) { tmr_start(tmr, period, peri
 
 void tmr_startFrom( tmr_t *tmr, cnt_t delay, cnt_t period, fun_t *proc );
 
+/******************************************************************************
+ *
+ * Name              : tmr_startSlack
+ *
+ * Description       : start/restart periodic timer for given duration of time with given tolerance
+ *                     when the timer has finished the countdown, the callback procedure is launched
+ *                     do this periodically if period > 0
+ *                     every expiration may be delayed by at most 'slack' ticks
+ *                     to be served together with the expiration of another task / timer
+ *
+ * Parameters
+ *   tmr             : pointer to timer object
+ *   delay           : duration of time (maximum number of ticks to countdown) for first expiration
+ *                     IMMEDIATE: don't countdown
+ *                     INFINITE:  countdown indefinitely
+ *   period          : duration of time (maximum number of ticks to countdown) for all next expirations
+ *                     IMMEDIATE: don't countdown
+ *                     INFINITE:  countdown indefinitely
+ *   slack           : maximum delay of every expiration (in ticks)
+ *                     0: expirations are not delayed (as in tmr_start)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     the next periods are counted from the expirations without the delay
+ *                     tmr_startNext keeps the tolerance, other start functions reset it
+ *
+ ******************************************************************************/
+
+void tmr_startSlack( tmr_t *tmr, cnt_t delay, cnt_t period, cnt_t slack );
+
 /******************************************************************************
  *
  * Name              : tmr_startNext
@@ -757,6 +794,8 @@ struct baseTimer : public __tmr
 	template<typename T>
 	void startPeriodic( const T _period )                                 {        tmr_startPeriodic(this, Clock::count(_period)); }
 	template<typename T>
+	void startSlack   ( const T _delay, const T _period, const T _slack ) {        tmr_startSlack   (this, Clock::count(_delay), Clock::count(_period), Clock::count(_slack)); }
+	template<typename T>
 	void startNext    ( const T _delay )                                  {        tmr_startNext    (this, Clock::count(_delay)); }
 	template<typename T>
 	void startUntil   ( const T _time )                                   {        tmr_startUntil   (this, Clock::until(_time)); }
@@ -0,0 +1,166 @@
+/******************************************************************************
+
+    @file    StateOS: ostrace.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOS_TRC_H
+#define __STATEOS_TRC_H
+
+#include "oskernel.h"
+
+/* -------------------------------------------------------------------------- */
+
+#define TRC_MAGIC         0x43525453UL // "STRC", the beginning of the header of the trace dump
+#define TRC_VERSION       1            // version of the format of the trace dump
+
+/* -------------------------------------------------------------------------- */
+
+// type of the trace record
+
+enum
+{
+	trcSwitch = 1,  // context switch; obj: next task, arg: previous task
+	trcWait,        // task blocked; obj: task, arg: BLOCKED queue of the supervising object
+	trcWakeup,      // task released; obj: task, arg: event value
+	trcTimer,       // timer expired; obj: timer, arg: event value
+	trcLost,        // records overwritten before they were read; obj: NULL, arg: number of the lost records
+	trcGive,        // object given; obj: object, arg: current task
+	trcTake,        // object taken without waiting; obj: object, arg: current task
+};
+
+/******************************************************************************
+ *
+ * Name              : trace record
+ *
+ ******************************************************************************/
+
+typedef struct __trc trc_t;
+
+struct __trc
+{
+	uint32_t  time; // timestamp, in cycles of the cycle counter (CYC_FREQUENCY)
+	unsigned  type; // type of the record
+	const
+	void    * obj;  // object of the record
+	uintptr_t arg;  // argument of the record
+};
+
+/******************************************************************************
+ *
+ * Name              : header of the trace dump
+ *
+ ******************************************************************************/
+
+typedef struct __trh trh_t;
+
+struct __trh
+{
+	uint32_t  magic;   // TRC_MAGIC
+	uint32_t  version; // TRC_VERSION
+	uint32_t  size;    // size of the trace record (in bytes)
+	uint32_t  ptr;     // size of the pointer (in bytes)
+	uint32_t  freq;    // frequency of the cycle counter (CYC_FREQUENCY)
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : core_trc_put
+ *
+ * Description       : put a record into the trace buffer; the oldest record is overwritten if the buffer is full
+ *
+ * Parameters
+ *   type            : type of the record
+ *   obj             : object of the record
+ *   arg             : argument of the record
+ *
+ * Return            : none
+ *
+ * Note              : for internal use
+ *                     must be called with interrupts disabled
+ *
+ ******************************************************************************/
+
+#if OS_TRACE_SIZE
+void core_trc_put( unsigned type, const void *obj, uintptr_t arg );
+#endif
+
+/******************************************************************************
+ *
+ * Name              : sys_traceRead
+ *
+ * Description       : move the oldest records from the trace buffer into the table
+ *
+ * Parameters
+ *   table           : pointer to the table of trace records
+ *   count           : size of the table (number of records)
+ *
+ * Return            : number of records moved into the table
+ *
+ * Note              : use only when OS_TRACE_SIZE > 0
+ *                     if some records were overwritten before they were read, the trcLost record is returned first
+ *                     may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+#if OS_TRACE_SIZE
+unsigned sys_traceRead( trc_t *table, unsigned count );
+#endif
+
+/******************************************************************************
+ *
+ * Name              : sys_traceDump
+ *
+ * Description       : move all records from the trace buffer to the host (through the port_trc_write function)
+ *                     the records are preceded by the header of the trace dump
+ *
+ * Parameters        : none
+ *
+ * Return            : none
+ *
+ * Note              : use only when OS_TRACE_SIZE > 0
+ *                     use only in thread mode
+ *                     the dump can be converted with the host tool (test/.trace/trace2json.c)
+ *
+ ******************************************************************************/
+
+#if OS_TRACE_SIZE
+void sys_traceDump( void );
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_TRC_H
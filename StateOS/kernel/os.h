@@ -2,7 +2,7 @@
 
     @file    StateOS: os.h
     @author  Rajmund Szymanski
-    @date    14.05.2020
+    @date    18.10.2026
     @brief   This file contains definitions for StateOS.
 
  ******************************************************************************
@@ -48,6 +48,7 @@
 #include "osalloc.h"
 #include "inc/osclock.h"
 #include "inc/oscriticalsection.h"
+#include "inc/ostrace.h"
 #include "inc/osspinlock.h"
 #include "inc/osonceflag.h"
 #include "inc/osevent.h"
@@ -61,11 +62,16 @@
 #include "inc/oslist.h"
 #include "inc/osmemorypool.h"
 #include "inc/osstreambuffer.h"
+#include "inc/ospipe.h"
 #include "inc/osmessagebuffer.h"
 #include "inc/osmailboxqueue.h"
 #include "inc/oseventqueue.h"
 #include "inc/osjobqueue.h"
+#include "inc/oslightweighttask.h"
 #include "inc/ostimer.h"
+#include "inc/osselect.h"
+#include "inc/osactiveobject.h"
+#include "inc/osstatemachine.h"
 #include "inc/ostask.h"
 
 #ifdef __cplusplus
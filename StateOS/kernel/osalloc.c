@@ -2,7 +2,7 @@
 
     @file    StateOS: osalloc.c
     @author  Rajmund Szymanski
-    @date    10.06.2020
+    @date    18.10.2026
     @brief   This file provides set of variables and functions for StateOS.
 
  ******************************************************************************
@@ -46,16 +46,61 @@
 
 #if OS_HEAP_SIZE
 
+#if OS_HEAP_TLSF
+// every memory segment must begin at the boundary of the segment header
+static
+seg_t            Heap[SEG_SIZE(OS_HEAP_SIZE)+1] __ALIGNED(sizeof(seg_t));
+#else
 static
 seg_t            Heap[SEG_SIZE(OS_HEAP_SIZE)+1] __ALIGNED(sizeof(stk_t));
+#endif
 #define HeapEnd (Heap+SEG_SIZE(OS_HEAP_SIZE))
 
+static
+struct
+{
+	size_t   used;  // total size of the allocated memory segments (with their headers)
+	size_t   peak;  // high-water mark of the total size of the allocated memory segments
+	unsigned fails; // number of failed allocations
+
+}	Info;
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE
+
+// memory segment 'mem' has been allocated
+static
+void priv_stats_alloc( seg_t *mem )
+{
+	Info.used += (mem->next - mem) * sizeof(seg_t);
+	if (Info.peak < Info.used)
+		Info.peak = Info.used;
+}
+
 #endif
 
 /* -------------------------------------------------------------------------- */
 
 #if OS_HEAP_SIZE
 
+// memory segment 'mem' is going to be released
+static
+void priv_stats_free( seg_t *mem )
+{
+	Info.used -= (mem->next - mem) * sizeof(seg_t);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+// INTERNAL ALLOC/FREE SERVICES (FIRST-FIT)
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE && OS_HEAP_TLSF == 0
+
 static
 seg_t *priv_init( void )
 {
@@ -73,7 +118,7 @@ seg_t *priv_init( void )
 
 /* -------------------------------------------------------------------------- */
 
-#if OS_HEAP_SIZE
+#if OS_HEAP_SIZE && OS_HEAP_TLSF == 0
 
 static
 void *priv_alloc( size_t alignment, size_t size )
@@ -119,10 +164,15 @@ void *priv_alloc( size_t alignment, size_t size )
 
 	//	memory segment can be allocated
 		mem->owner = NULL;
+		priv_stats_alloc(mem);
 		mem = mem + 1;
 		break;
 	}
 
+	if (mem == NULL)
+	//	there is no free memory segment large enough
+		Info.fails++;
+
 	return mem;
 }
 
@@ -130,7 +180,7 @@ void *priv_alloc( size_t alignment, size_t size )
 
 /* -------------------------------------------------------------------------- */
 
-#if OS_HEAP_SIZE
+#if OS_HEAP_SIZE && OS_HEAP_TLSF == 0
 
 static
 void priv_free( void *ptr )
@@ -144,7 +194,10 @@ void priv_free( void *ptr )
 	//	this is not the memory segment we are looking for
 			continue;
 
+		if (mem->owner == NULL)
 	//	memory segment can be released
+			priv_stats_free(mem);
+
 		mem->owner = mem;
 		break;
 	}
@@ -154,7 +207,7 @@ void priv_free( void *ptr )
 
 /* -------------------------------------------------------------------------- */
 
-#if OS_HEAP_SIZE
+#if OS_HEAP_SIZE && OS_HEAP_TLSF == 0
 
 static
 void *priv_realloc( void *ptr, size_t size )
@@ -174,6 +227,8 @@ void *priv_realloc( void *ptr, size_t size )
 	//	memory segment is not allocated
 			return NULL;
 
+		priv_stats_free(mem);
+
 		while (nxt = mem->next, nxt->owner != NULL)
 	//	it is possible to attach adjacent free memory segment
 			mem->next = nxt->next;
@@ -187,6 +242,8 @@ void *priv_realloc( void *ptr, size_t size )
 			mem->next  = nxt;
 		}
 
+		priv_stats_alloc(mem);
+
 		len = (mem->next - mem) * sizeof(seg_t) - sizeof(seg_t);
 		if (len >= size)
 	//	memory segment has been successfully resized
@@ -211,7 +268,7 @@ void *priv_realloc( void *ptr, size_t size )
 
 /* -------------------------------------------------------------------------- */
 
-#if OS_HEAP_SIZE
+#if OS_HEAP_SIZE && OS_HEAP_TLSF == 0
 
 static
 size_t priv_size( void )
@@ -238,9 +295,445 @@ size_t priv_size( void )
 
 #endif
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE && OS_HEAP_TLSF == 0
+
+static
+void priv_stats( hst_t *hst )
+{
+	seg_t *mem;
+	seg_t *nxt;
+	size_t size;
+
+	for (mem = priv_init(); mem != HeapEnd; mem = mem->next)
+	{
+		if (mem->owner == NULL)
+		{
+	//	memory segment has already been allocated
+			hst->taken++;
+			continue;
+		}
+
+		while (nxt = mem->next, nxt->owner != NULL)
+	//	it is possible to merge adjacent free memory segments
+			mem->next = nxt->next;
+
+		size = (mem->next - mem) * sizeof(seg_t) - sizeof(seg_t);
+		if (hst->max < size)
+			hst->max = size;
+		hst->size += size;
+		hst->free++;
+	}
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+// INTERNAL ALLOC/FREE SERVICES (TLSF)
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE && OS_HEAP_TLSF
+
+// every power of 2 class of segment sizes is divided into SEG_SL linear subclasses
+#define SEG_LOG   2
+#define SEG_SL   (1U << SEG_LOG)
+#define SEG_FL   (32 - SEG_LOG + 1)
+
+// class 0 is the most significant bit of the bitmap
+#define SEG_BIT( idx ) \
+        (0x80000000UL >> (idx))
+
+// classes greater than or equal to 'idx'
+#define SEG_MASK( idx ) \
+        (0xFFFFFFFFUL >> (idx))
+
+// free memory segment is the first one in its list if its owner points to itself,
+// otherwise the owner points to the previous free memory segment in the list
+
+static
+struct
+{
+	uint32_t fl;                    // bitmap of the non-empty classes
+	uint32_t sl[SEG_FL];            // bitmaps of the non-empty subclasses
+	seg_t  * list[SEG_FL][SEG_SL];  // lists of the free memory segments
+
+}	Free;
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE && OS_HEAP_TLSF
+
+// get the class and subclass of the memory segment of 'size' units
+static
+void priv_class( uint32_t size, unsigned *fl, unsigned *sl )
+{
+	unsigned msb = 31 - core_map_first(size);
+
+	if (msb < SEG_LOG)
+	{
+		*fl = 0;
+		*sl = size;
+	}
+	else
+	{
+		*fl = msb - SEG_LOG + 1;
+		*sl = (size >> (msb - SEG_LOG)) - SEG_SL;
+	}
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE && OS_HEAP_TLSF
+
+static
+void priv_insert( seg_t *seg )
+{
+	seg_t  * nxt;
+	unsigned fl, sl;
+
+	priv_class(seg->next - seg, &fl, &sl);
+
+	nxt = Free.list[fl][sl];
+	if (nxt != NULL)
+		nxt->owner = seg;
+	seg->owner = seg;
+	seg->list  = nxt;
+	Free.list[fl][sl] = seg;
+
+	Free.sl[fl] |= SEG_BIT(sl);
+	Free.fl     |= SEG_BIT(fl);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE && OS_HEAP_TLSF
+
+static
+void priv_remove( seg_t *seg )
+{
+	seg_t  * nxt = seg->list;
+	unsigned fl, sl;
+
+	if (seg->owner != seg)
+	{
+	//	memory segment is not the first one in the list
+		seg->owner->list = nxt;
+		if (nxt != NULL)
+			nxt->owner = seg->owner;
+	}
+	else
+	{
+		priv_class(seg->next - seg, &fl, &sl);
+
+		Free.list[fl][sl] = nxt;
+		if (nxt != NULL)
+			nxt->owner = nxt;
+		else
+		if ((Free.sl[fl] &= ~SEG_BIT(sl)) == 0)
+			Free.fl &= ~SEG_BIT(fl);
+	}
+
+	seg->owner = NULL;
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE && OS_HEAP_TLSF
+
+static
+void priv_init( void )
+{
+	if (Heap[0].next == NULL)
+	{
+	//	system heap must be initialized
+		Heap[0].next  = HeapEnd;
+		HeapEnd->prev = Heap;
+		priv_insert(Heap);
+	}
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE && OS_HEAP_TLSF
+
+// find the free memory segment of at least 'size' units
+static
+seg_t *priv_find( uint32_t size )
+{
+	uint32_t map;
+	unsigned fl, sl;
+
+	priv_init();
+
+	priv_class(size, &fl, &sl);
+	if (fl > 0)
+	{
+	//	round up to the next subclass; every segment in it is large enough
+		size += (1UL << (fl - 1)) - 1;
+		priv_class(size, &fl, &sl);
+	}
+
+	map = Free.sl[fl] & SEG_MASK(sl);
+	if (map == 0)
+	{
+		map = Free.fl & SEG_MASK(fl + 1);
+		if (map == 0)
+	//	there is no free memory segment large enough
+			return NULL;
+
+		fl  = core_map_first(map);
+		map = Free.sl[fl];
+	}
+
+	sl = core_map_first(map);
+
+	return Free.list[fl][sl];
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE && OS_HEAP_TLSF
+
+// separate the memory segment 'nxt' from the memory segment 'mem'
+static
+void priv_split( seg_t *mem, seg_t *nxt )
+{
+	nxt->next  = mem->next;
+	nxt->prev  = mem;
+	mem->next->prev = nxt;
+	mem->next  = nxt;
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE && OS_HEAP_TLSF
+
+// attach the memory segment following the memory segment 'mem'
+static
+void priv_merge( seg_t *mem )
+{
+	mem->next = mem->next->next;
+	mem->next->prev = mem;
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE && OS_HEAP_TLSF
+
+static
+void *priv_alloc( size_t alignment, size_t size )
+{
+	seg_t *mem;
+	seg_t *nxt;
+
+	size = SEG_SIZE(size + sizeof(seg_t));
+
+	mem = priv_find(alignment > sizeof(stk_t) ? size + SEG_SIZE(alignment) : size);
+	if (mem == NULL)
+	{
+	//	there is no free memory segment large enough
+		Info.fails++;
+		return NULL;
+	}
+
+	priv_remove(mem);
+
+	nxt = SEG_ALIGN(mem, alignment);
+
+	if (nxt > mem)
+	{
+	//	memory segment must be aligned
+		priv_split(mem, nxt);
+		priv_insert(mem);
+		mem = nxt;
+	}
+
+	if (mem + size < mem->next)
+	{
+	//	memory segment is larger than required
+		nxt = mem + size;
+		priv_split(mem, nxt);
+		priv_insert(nxt);
+	}
+
+	//	memory segment can be allocated
+	mem->owner = NULL;
+	priv_stats_alloc(mem);
+	return mem + 1;
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE && OS_HEAP_TLSF
+
+static
+void priv_free( void *ptr )
+{
+	seg_t *mem = (seg_t *)ptr - 1;
+	seg_t *nxt;
+
+	assert(mem->owner == NULL);
+
+	priv_stats_free(mem);
+
+	nxt = mem->next;
+	if (nxt->owner != NULL)
+	{
+	//	it is possible to attach the next free memory segment
+		priv_remove(nxt);
+		priv_merge(mem);
+	}
+
+	nxt = mem->prev;
+	if (nxt != NULL && nxt->owner != NULL)
+	{
+	//	it is possible to attach to the previous free memory segment
+		priv_remove(nxt);
+		priv_merge(nxt);
+		mem = nxt;
+	}
+
+	//	memory segment can be released
+	priv_insert(mem);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE && OS_HEAP_TLSF
+
+static
+void *priv_realloc( void *ptr, size_t size )
+{
+	seg_t *mem = (seg_t *)ptr - 1;
+	seg_t *nxt;
+	size_t len = SEG_SIZE(size + sizeof(seg_t));
+
+	if (mem->owner != NULL)
+	//	memory segment is not allocated
+		return NULL;
+
+	priv_stats_free(mem);
+
+	nxt = mem->next;
+	if (nxt->owner != NULL)
+	{
+	//	it is possible to attach the next free memory segment
+		priv_remove(nxt);
+		priv_merge(mem);
+	}
+
+	if (mem + len < mem->next)
+	{
+	//	it is possible to reduce the size of the memory segment
+		nxt = mem + len;
+		priv_split(mem, nxt);
+		priv_insert(nxt);
+	}
+
+	priv_stats_alloc(mem);
+
+	len = (mem->next - mem) * sizeof(seg_t) - sizeof(seg_t);
+	if (len >= size)
+	//	memory segment has been successfully resized
+		return ptr;
+
+	mem = priv_alloc(sizeof(stk_t), size);
+
+	if (mem != NULL)
+	{
+	//	new memory segment has been successfully allocated
+		memcpy(mem, ptr, len);
+		priv_free(ptr);
+	}
+
+	return mem;
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE && OS_HEAP_TLSF
+
+static
+size_t priv_size( void )
+{
+	seg_t *mem;
+	size_t size = 0;
+
+	priv_init();
+
+	for (mem = Heap; mem != HeapEnd; mem = mem->next)
+	{
+		if (mem->owner == NULL)
+	//	memory segment has already been allocated
+			continue;
+
+		size += (mem->next - mem) * sizeof(seg_t) - sizeof(seg_t);
+	}
+
+	return size;
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE && OS_HEAP_TLSF
+
+static
+void priv_stats( hst_t *hst )
+{
+	seg_t *mem;
+	size_t size;
+
+	priv_init();
+
+	for (mem = Heap; mem != HeapEnd; mem = mem->next)
+	{
+		if (mem->owner == NULL)
+		{
+	//	memory segment has already been allocated
+			hst->taken++;
+			continue;
+		}
+
+		size = (mem->next - mem) * sizeof(seg_t) - sizeof(seg_t);
+		if (hst->max < size)
+			hst->max = size;
+		hst->size += size;
+		hst->free++;
+	}
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 // STANDARD ALLOC/FREE SERVICES
 /* -------------------------------------------------------------------------- */
+// the system heap is used only in thread mode, so it is protected with the scheduler lock;
+// interrupts remain enabled during the search of the free segments
 
 #if OS_HEAP_SIZE
 
@@ -252,11 +745,11 @@ void *memalign( size_t alignment, size_t size )
 	assert(alignment>0&&alignment==(alignment&-alignment));
 	assert(size>0&&size<(OS_HEAP_SIZE));
 
-	sys_lock();
+	sys_schedLock();
 	{
 		mem = priv_alloc(alignment, size);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	assert(mem);
 
@@ -277,11 +770,11 @@ void *aligned_alloc( size_t alignment, size_t size )
 	assert(alignment>0&&alignment==(alignment&-alignment));
 	assert(size>0&&size<(OS_HEAP_SIZE)&&(size%alignment)==0);
 
-	sys_lock();
+	sys_schedLock();
 	{
 		mem = priv_alloc(alignment, size);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	assert(mem);
 
@@ -300,11 +793,11 @@ int posix_memalign( void **ptr, size_t alignment, size_t size )
 	assert(alignment>=sizeof(void*)&&alignment==(alignment&-alignment));
 	assert(size>0&&size<(OS_HEAP_SIZE));
 
-	sys_lock();
+	sys_schedLock();
 	{
 		*ptr = priv_alloc(alignment, size);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	assert(*ptr);
 
@@ -324,11 +817,11 @@ void *malloc( size_t size )
 	assert_tsk_context();
 	assert(size>0&&size<(OS_HEAP_SIZE));
 
-	sys_lock();
+	sys_schedLock();
 	{
 		mem = priv_alloc(sizeof(stk_t), size);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	assert(mem);
 
@@ -345,7 +838,20 @@ void *calloc( size_t num, size_t size )
 {
 	void *mem;
 
-	mem = malloc(size *= num);
+	assert_tsk_context();
+	assert(size*num>0&&size*num<(OS_HEAP_SIZE));
+
+	size *= num;
+
+//	priv_alloc is used directly, because the compiler could replace
+//	the sequence of malloc and memset with the call to calloc itself
+	sys_schedLock();
+	{
+		mem = priv_alloc(sizeof(stk_t), size);
+	}
+	sys_schedUnlock();
+
+	assert(mem);
 
 	if (mem != NULL)
 		memset(mem, 0, size);
@@ -368,11 +874,11 @@ void free( void *ptr )
 	// nothing to release
 		return;
 
-	sys_lock();
+	sys_schedLock();
 	{
 		priv_free(ptr);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 }
 
 #endif
@@ -400,11 +906,11 @@ void *realloc( void *ptr, size_t size )
 		return NULL;
 	}
 
-	sys_lock();
+	sys_schedLock();
 	{
 		mem = priv_realloc(ptr, size);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	assert(mem);
 
@@ -416,6 +922,7 @@ void *realloc( void *ptr, size_t size )
 /* -------------------------------------------------------------------------- */
 // SYSTEM HEAP SERVICES
 /* -------------------------------------------------------------------------- */
+// the task deleter runs inside the critical section, the heap is walked with the scheduler locked
 
 size_t sys_heapSize( void )
 {
@@ -426,26 +933,58 @@ size_t sys_heapSize( void )
 	sys_lock();
 	{
 		core_tsk_deleter();
+	}
+	sys_unlock();
+
+	sys_schedLock();
+	{
 #if OS_HEAP_SIZE
 		size = priv_size();
 #else
 		size = 0;
 #endif
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return size;
 }
 
 /* -------------------------------------------------------------------------- */
 
+void sys_heapStats( hst_t *hst )
+{
+	assert_tsk_context();
+	assert(hst);
+
+	memset(hst, 0, sizeof(hst_t));
+
+	sys_lock();
+	{
+		core_tsk_deleter();
+	}
+	sys_unlock();
+
+	sys_schedLock();
+	{
+#if OS_HEAP_SIZE
+		priv_stats(hst);
+		hst->used  = Info.used;
+		hst->peak  = Info.peak;
+		hst->fails = Info.fails;
+#endif
+	}
+	sys_schedUnlock();
+}
+
+/* -------------------------------------------------------------------------- */
+
 size_t sys_segSize( void *ptr )
 {
 	size_t size;
 
 	assert_tsk_context(); 
 
-	sys_lock();
+	sys_schedLock();
 	{
 #if OS_HEAP_SIZE
 		seg_t *seg = (seg_t *)ptr - 1;
@@ -455,7 +994,7 @@ size_t sys_segSize( void *ptr )
 		size = 0;
 #endif
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return size;
 }
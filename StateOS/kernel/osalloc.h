@@ -2,7 +2,7 @@
 
     @file    StateOS: osalloc.h
     @author  Rajmund Szymanski
-    @date    09.06.2020
+    @date    18.10.2026
     @brief   This file contains definitions for StateOS.
 
  ******************************************************************************
@@ -50,6 +50,29 @@ struct __seg
 {
 	seg_t  * next;  // next memory block
 	seg_t  * owner; // owner of memory block (used as free / occupied flag)
+#if OS_HEAP_TLSF
+	seg_t  * prev;  // previous memory block
+	seg_t  * list;  // next free memory block of the same size class
+#endif
+};
+
+/******************************************************************************
+ *
+ * Name              : heap statistics
+ *
+ ******************************************************************************/
+
+typedef struct __hst hst_t;
+
+struct __hst
+{
+	size_t   size;  // total size of free memory segments (in bytes)
+	size_t   max;   // size of the largest free memory segment (in bytes)
+	size_t   used;  // total size of allocated memory segments, including their headers (in bytes)
+	size_t   peak;  // high-water mark of the total size of allocated memory segments (in bytes)
+	unsigned free;  // number of free memory segments
+	unsigned taken; // number of allocated memory segments
+	unsigned fails; // number of failed allocations
 };
 
 /******************************************************************************
@@ -106,6 +129,25 @@ void sys_free( void *ptr ) { free(ptr); }
 
 size_t sys_heapSize( void );
 
+/******************************************************************************
+ *
+ * Name              : sys_heapStats
+ *
+ * Description       : get statistics of the dedicated heap memory
+ *                     (the largest free memory segment compared to the total size of free memory segments shows fragmentation of the heap)
+ *
+ * Parameters
+ *   hst             : pointer to the structure to be filled with the heap statistics
+ *                     (all statistics are zero if there is no dedicated heap memory)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void sys_heapStats( hst_t *hst );
+
 /******************************************************************************
  *
  * Name              : sys_segSize
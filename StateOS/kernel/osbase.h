@@ -2,7 +2,7 @@
 
     @file    StateOS: osbase.h
     @author  Rajmund Szymanski
-    @date    09.06.2020
+    @date    18.10.2026
     @brief   This file contains basic definitions for StateOS.
 
  ******************************************************************************
@@ -58,6 +58,10 @@ extern "C" {
 #define OS_GUARD_SIZE     0
 #endif
 
+#ifndef OS_FRAME_SIZE
+#define OS_FRAME_SIZE     0
+#endif
+
 #ifndef __MPU_USED
 #define __MPU_USED        0
 #endif
@@ -97,6 +101,84 @@ typedef uint64_t     cnt_t;
 
 /* -------------------------------------------------------------------------- */
 
+#ifndef OS_PRIO_LEVELS
+#define OS_PRIO_LEVELS    0
+#endif
+
+#if     OS_PRIO_LEVELS > 32
+#error  Invalid OS_PRIO_LEVELS value!
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_TIMER_WHEEL
+#define OS_TIMER_WHEEL    0
+#endif
+
+#ifndef OS_TIMER_SLOT
+#define OS_TIMER_SLOT     1
+#endif
+
+#ifndef OS_TIMER_LEVELS
+#define OS_TIMER_LEVELS   2
+#endif
+
+#if     OS_TIMER_WHEEL > 32 || (OS_TIMER_WHEEL & (OS_TIMER_WHEEL - 1))
+#error  Invalid OS_TIMER_WHEEL value!
+#endif
+
+#if     OS_TIMER_SLOT == 0 || (OS_TIMER_SLOT & (OS_TIMER_SLOT - 1))
+#error  Invalid OS_TIMER_SLOT value!
+#endif
+
+#if     OS_TIMER_LEVELS == 0 || OS_TIMER_LEVELS > 4
+#error  Invalid OS_TIMER_LEVELS value!
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_LOCK_TRACE
+#define OS_LOCK_TRACE     0
+#endif
+
+#ifndef OS_TRACE_SIZE
+#define OS_TRACE_SIZE     0
+#endif
+
+#if     OS_TRACE_SIZE & (OS_TRACE_SIZE - 1)
+#error  Invalid OS_TRACE_SIZE value!
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_HEAP_TLSF
+#define OS_HEAP_TLSF      0
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_TICKLESS_IDLE
+#define OS_TICKLESS_IDLE  0
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_TASK_STATS
+#define OS_TASK_STATS     0
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_TIMER_TASK
+#define OS_TIMER_TASK     0
+#endif
+
+#ifndef OS_TIMER_STACK
+#define OS_TIMER_STACK    OS_STACK_SIZE
+#endif
+
+/* -------------------------------------------------------------------------- */
+
 #if     HW_TIMER_SIZE > OS_TIMER_SIZE
 #error  HW_TIMER_SIZE > OS_TIMER_SIZE causes unexpected problems!
 #endif
@@ -183,10 +265,27 @@ void core_hdr_init( hdr_t *hdr, void *res )
 typedef struct __sys
 {
 	tsk_t  * cur;   // pointer to the current task control block
+#if OS_PRIO_LEVELS
+	uint32_t map;   // bitmap of the non-empty priority levels of the READY queue
+	tsk_t  * last[OS_PRIO_LEVELS]; // last task of each priority level in the READY queue
+#endif
 #if HW_TIMER_SIZE < OS_TIMER_SIZE
 	volatile
 	cnt_t    cnt;   // system timer counter
 #endif
+#if OS_TIMER_TASK
+	tmr_t  * tmr;   // timer whose callback procedure is executed by the timer task
+#endif
+	tsk_t  * sel;   // queue of the tasks waiting for multiple objects
+	unsigned lock;  // nesting counter of the scheduler lock
+	bool     pend;  // context switch requested while the scheduler was locked
+#if OS_TASK_STATS
+	uint32_t stamp; // value of the cycle counter at the last update of the run time
+#if HW_TIMER_SIZE || OS_TICKLESS_IDLE
+	cnt_t    start; // value of the system timer at the last update of the run time
+#endif
+	uint64_t time;  // total run time of all tasks, in cycles of the cycle counter (CYC_FREQUENCY)
+#endif
 
 }	sys_t;
 
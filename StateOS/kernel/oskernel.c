@@ -2,7 +2,7 @@
 
     @file    StateOS: oskernel.c
     @author  Rajmund Szymanski
-    @date    09.06.2020
+    @date    18.10.2026
     @brief   This file provides set of variables and functions for StateOS.
 
  ******************************************************************************
@@ -33,6 +33,7 @@
 #include "inc/ostimer.h"
 #include "inc/ostask.h"
 #include "inc/osmutex.h"
+#include "inc/ostrace.h"
 
 /* -------------------------------------------------------------------------- */
 // SYSTEM INTERNAL SERVICES
@@ -41,9 +42,16 @@
 static
 void priv_ctx_switchNow( void )
 {
+	assert(System.lock == 0); // the current task cannot be blocked or stopped while the scheduler is locked
+#if OS_LOCK_TRACE
+	void *cri = core_cri_suspend();
+#endif
 	port_ctx_switch();
 	port_clr_lock(); __ISB();
 	port_set_lock();
+#if OS_LOCK_TRACE
+	core_cri_resume(cri);
+#endif
 }
 
 /* -------------------------------------------------------------------------- */
@@ -71,6 +79,24 @@ void priv_rdy_remove( hdr_t *hdr )
 	prv->next = nxt;
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_PRIO_LEVELS
+
+// all priorities greater than or equal to (OS_PRIO_LEVELS - 1) share the last level
+#define RDY_LEVEL( prio ) \
+        ((prio) < (OS_PRIO_LEVELS) - 1 ? (prio) : (OS_PRIO_LEVELS) - 1)
+
+// level 0 is the most significant bit of the bitmap
+#define RDY_BIT( level ) \
+        (0x80000000UL >> (level))
+
+// levels greater than or equal to 'level'
+#define RDY_MASK( level ) \
+        (0xFFFFFFFFUL >> (level))
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 // SYSTEM TIMER SERVICES
 /* -------------------------------------------------------------------------- */
@@ -79,8 +105,49 @@ tmr_t WAIT = { .hdr={ .prev=&WAIT, .next=&WAIT, .id=ID_TIMER }, .delay=INFINITE
 
 /* -------------------------------------------------------------------------- */
 
+#if OS_TIMER_WHEEL
+
+// slot 0 is the most significant bit of the bitmap
+#define TMR_BIT( slot ) \
+        (0x80000000UL >> (slot))
+
+// slots greater than or equal to 'slot'
+#define TMR_MASK( slot ) \
+        (0xFFFFFFFFUL >> (slot))
+
+// queue of the timers of the 'slot' of the 'level'
+#define TMR_HDR( level, slot ) \
+        (&WHEEL.slot[(level) * (OS_TIMER_WHEEL) + (slot)])
+
+// timers expiring after the current slot wait unsorted in the slots of the hierarchical timing wheel
+// slot of the level 'n' spans (OS_TIMER_SLOT * OS_TIMER_WHEEL^n) ticks
+// timer is hung in the lowest level where its expiration falls within the next (OS_TIMER_WHEEL - 1) slots
+// at the beginning of each non-empty slot the wheel timer moves its timers to the lower level (cascade)
+// and the timers expiring in the current slot of the lowest level to the WAIT queue
+static struct
+{
+	uint32_t map [OS_TIMER_LEVELS];                  // bitmaps of the non-empty slots
+	hdr_t    slot[OS_TIMER_LEVELS * OS_TIMER_WHEEL]; // queues of the timers
+	tmr_t    tmr;                                    // wheel timer
+
+}	WHEEL;
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIMER_TASK
+
+// expired timers with callback procedures wait in the PEND queue for the timer task
+// the timer task waits for the expired timers in the BLOCKED queue of PEND
+static hdr_t PEND = { .obj={ .queue=&TIMER }, .prev=&PEND, .next=&PEND };
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
 static
-void priv_tmr_insert( tmr_t *tmr )
+void priv_tmr_link( tmr_t *tmr )
 {
 	tmr_t *nxt = &WAIT;
 
@@ -88,23 +155,437 @@ void priv_tmr_insert( tmr_t *tmr )
 		do nxt = nxt->hdr.next;
 		while (nxt->delay < (cnt_t)(tmr->start + tmr->delay - nxt->start));
 
-	tmr->hdr.id = ID_TIMER;
 	priv_rdy_insert(&tmr->hdr, &nxt->hdr);
 }
 
 /* -------------------------------------------------------------------------- */
 
+#if OS_TIMER_WHEEL
+
+// time span of the slot of the 'level'
+static
+cnt_t priv_tmr_span( unsigned level )
+{
+	cnt_t span = OS_TIMER_SLOT;
+
+	while (level--)
+		span *= OS_TIMER_WHEEL;
+
+	return span;
+}
+
+/* -------------------------------------------------------------------------- */
+
+// slot of the 'level' containing the system time 'time'
+static
+unsigned priv_tmr_slot( cnt_t time, unsigned level )
+{
+	return (unsigned)(time / priv_tmr_span(level)) % (OS_TIMER_WHEEL);
+}
+
+/* -------------------------------------------------------------------------- */
+
+// return time from 'now' to the beginning of the 'slot' of the 'level' following the current one
+static
+cnt_t priv_tmr_slotTime( unsigned level, unsigned slot, cnt_t now )
+{
+	cnt_t    span = priv_tmr_span(level);
+	unsigned cnt  = (slot - priv_tmr_slot(now, level) - 1) % (OS_TIMER_WHEEL) + 1;
+
+	return (cnt_t)cnt * span - now % span;
+}
+
+/* -------------------------------------------------------------------------- */
+
+// start the wheel timer at the beginning of the nearest non-empty slot
+static
+void priv_tmr_rewind( cnt_t now )
+{
+	cnt_t    delay = INFINITE;
+	cnt_t    time;
+	uint32_t map;
+	unsigned level;
+
+	if (WHEEL.tmr.hdr.id != ID_STOPPED)
+	{
+		WHEEL.tmr.hdr.id = ID_STOPPED;
+		priv_rdy_remove(&WHEEL.tmr.hdr);
+	}
+
+	for (level = 0; level < OS_TIMER_LEVELS; level++)
+	{
+		if (WHEEL.map[level] == 0)
+			continue;
+
+		map  = WHEEL.map[level] & TMR_MASK((priv_tmr_slot(now, level) + 1) % (OS_TIMER_WHEEL));
+		time = priv_tmr_slotTime(level, core_map_first(map ? map : WHEEL.map[level]), now);
+		if (delay > time)
+			delay = time;
+	}
+
+	if (delay != INFINITE)
+	{
+		WHEEL.tmr.start = now;
+		WHEEL.tmr.delay = delay;
+		WHEEL.tmr.hdr.id = ID_TIMER;
+		priv_tmr_link(&WHEEL.tmr);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+// insert the expired timer after the timers that expired earlier ('late' ago)
+static
+void priv_tmr_late( tmr_t *tmr, cnt_t late, cnt_t now )
+{
+	tmr_t *nxt = WAIT.hdr.next;
+
+	while (nxt->delay != INFINITE && nxt->delay <= (cnt_t)(now - nxt->start) && (cnt_t)(now - nxt->start - nxt->delay) > late)
+		nxt = nxt->hdr.next;
+
+	priv_rdy_insert(&tmr->hdr, &nxt->hdr);
+}
+
+/* -------------------------------------------------------------------------- */
+
+// hang the timer expiring after the current slot in the slot of the wheel (in constant time)
+static
+void priv_tmr_hang( tmr_t *tmr, cnt_t now )
+{
+	cnt_t    time = tmr->start + tmr->delay - now;
+	cnt_t    span = 0;
+	cnt_t    cnt  = 0;
+	unsigned level;
+	unsigned slot;
+	hdr_t  * hdr;
+
+//	number of slots from the current one to the slot of the expiration, in the lowest level where it is less than the size of the wheel
+	for (level = 0; level < OS_TIMER_LEVELS; level++)
+	{
+		span = priv_tmr_span(level);
+		cnt  = time / span + (time % span + now % span) / span;
+		if (cnt < OS_TIMER_WHEEL)
+			break;
+	}
+
+//	timer expiring beyond the wheel is hung in the farthest slot of the highest level and cascaded from there again
+	if (level == OS_TIMER_LEVELS)
+	{
+		level = OS_TIMER_LEVELS - 1;
+		cnt   = OS_TIMER_WHEEL - 1;
+	}
+
+	slot = (priv_tmr_slot(now, level) + (unsigned)cnt) % (OS_TIMER_WHEEL);
+	hdr  = TMR_HDR(level, slot);
+
+	if ((WHEEL.map[level] & TMR_BIT(slot)) == 0)
+	{
+		hdr->prev = hdr->next = hdr;
+		WHEEL.map[level] |= TMR_BIT(slot);
+
+	//	the wheel timer is not moved later if it has already finished counting
+		time = now - WHEEL.tmr.start;
+		if (WHEEL.tmr.hdr.id == ID_STOPPED || (WHEEL.tmr.delay > time &&
+		    WHEEL.tmr.delay - time > priv_tmr_slotTime(level, slot, now)))
+			priv_tmr_rewind(now);
+	}
+
+	priv_rdy_insert(&tmr->hdr, hdr);
+}
+
+/* -------------------------------------------------------------------------- */
+
+// check whether the timer expires in the current slot of the lowest level (or has already expired)
+static
+bool priv_tmr_due( tmr_t *tmr, cnt_t now )
+{
+	cnt_t time = now - tmr->start;
+
+	return tmr->delay <= time || tmr->delay - time < (OS_TIMER_SLOT) - now % (OS_TIMER_SLOT);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tmr_place( tmr_t *tmr )
+{
+#if OS_TIMER_WHEEL
+	cnt_t now  = core_sys_time();
+	cnt_t time = now - tmr->start;
+
+	if (tmr->delay != INFINITE)
+	{
+	//	restarted timers may have already finished counting
+		if (tmr->delay <= time)
+		{
+			priv_tmr_late(tmr, time - tmr->delay, now);
+			return;
+		}
+
+		if (!priv_tmr_due(tmr, now))
+		{
+			priv_tmr_hang(tmr, now);
+			return;
+		}
+	}
+#endif
+	priv_tmr_link(tmr);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tmr_insert( tmr_t *tmr )
+{
+	tmr->hdr.id = ID_TIMER;
+	priv_tmr_place(tmr);
+}
+
+/* -------------------------------------------------------------------------- */
+
 static
 void priv_tmr_remove( tmr_t *tmr )
 {
+#if OS_TIMER_WHEEL
+	hdr_t  * hdr  = tmr->hdr.prev;
+	unsigned slot;
+
+	if (hdr >= WHEEL.slot && hdr < WHEEL.slot + OS_TIMER_LEVELS * OS_TIMER_WHEEL && hdr == tmr->hdr.next) // the last timer of the slot
+	{
+		slot = (unsigned)(hdr - WHEEL.slot);
+		WHEEL.map[slot / (OS_TIMER_WHEEL)] &= ~TMR_BIT(slot % (OS_TIMER_WHEEL));
+	}
+#endif
 	tmr->hdr.id = ID_STOPPED;
 	priv_rdy_remove(&tmr->hdr);
 }
 
 /* -------------------------------------------------------------------------- */
 
+#if OS_TIMER_WHEEL
+
+// compare expirations of the timers
+static
+bool priv_tmr_before( tmr_t *tmr, tmr_t *nxt )
+{
+	if (tmr->delay == INFINITE)
+		return false;
+	if (nxt->delay == INFINITE)
+		return true;
+
+	return (cnt_t)(nxt->start + nxt->delay - tmr->start - tmr->delay - 1) < INFINITE / 2;
+}
+
+/* -------------------------------------------------------------------------- */
+
+// sort the list of timers linked by hdr.next by their expirations (bottom-up merge sort in O(n log n) time and constant space)
+static
+tmr_t *priv_tmr_sort( tmr_t *lst )
+{
+	tmr_t  * one;
+	tmr_t  * two;
+	tmr_t  * tmr;
+	tmr_t  * end;
+	unsigned size;
+	unsigned cnt1;
+	unsigned cnt2;
+	unsigned runs;
+
+	for (size = 1; lst != NULL; size *= 2)
+	{
+		one = lst;
+		lst = end = NULL;
+		runs = 0;
+
+		while (one != NULL)
+		{
+			runs++;
+			for (two = one, cnt1 = 0; cnt1 < size && two != NULL; cnt1++)
+				two = two->hdr.next;
+			cnt2 = size;
+
+			while (cnt1 > 0 || (cnt2 > 0 && two != NULL))
+			{
+				if (cnt1 > 0 && (cnt2 == 0 || two == NULL || !priv_tmr_before(two, one)))
+					tmr = one, one = one->hdr.next, cnt1--;
+				else
+					tmr = two, two = two->hdr.next, cnt2--;
+
+				if (end == NULL)
+					lst = tmr;
+				else
+					end->hdr.next = tmr;
+				end = tmr;
+			}
+
+			one = two;
+		}
+
+		end->hdr.next = NULL;
+		if (runs == 1)
+			break;
+	}
+
+	return lst;
+}
+
+/* -------------------------------------------------------------------------- */
+
+// merge the sorted list of timers linked by hdr.next into the WAIT queue (in linear time)
+static
+void priv_tmr_merge( tmr_t *lst )
+{
+	tmr_t *nxt = WAIT.hdr.next;
+	tmr_t *tmr;
+
+	while (tmr = lst, tmr != NULL)
+	{
+		lst = tmr->hdr.next;
+		while (nxt != &WAIT && !priv_tmr_before(tmr, nxt))
+			nxt = nxt->hdr.next;
+		priv_rdy_insert(&tmr->hdr, &nxt->hdr);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+// move timers of the slots beginning from the expiration of the wheel timer to 'now'
+// to the lower levels of the wheel (each timer is moved at most once per level)
+// and timers expiring in the current slot of the lowest level to the WAIT queue
+static
+void priv_tmr_rotate( void )
+{
+	cnt_t    now  = core_sys_time();
+	cnt_t    time = WHEEL.tmr.start + WHEEL.tmr.delay;
+	tmr_t  * due  = NULL;
+	cnt_t    span;
+	cnt_t    skip;
+	cnt_t    cnt;
+	unsigned level;
+	unsigned slot;
+	hdr_t  * hdr;
+	tmr_t  * tmr;
+	tmr_t  * nxt;
+
+	for (level = OS_TIMER_LEVELS; level-- > 0; )
+	{
+		span = priv_tmr_span(level);
+		skip = (span - time % span) % span; // time to the first beginning of the slot of the level
+		if (skip > (cnt_t)(now - time))
+			continue;
+
+		cnt  = (now - time - skip) / span;
+		if (cnt >= OS_TIMER_WHEEL)
+			cnt = OS_TIMER_WHEEL - 1;
+		slot = priv_tmr_slot(time + skip, level);
+
+		do
+		{
+			if (WHEEL.map[level] & TMR_BIT(slot))
+			{
+				WHEEL.map[level] &= ~TMR_BIT(slot);
+				hdr = TMR_HDR(level, slot);
+				tmr = hdr->next;
+				((tmr_t *)hdr->prev)->hdr.next = NULL;
+				hdr->prev = hdr->next = hdr;
+
+				for (; tmr != NULL; tmr = nxt)
+				{
+					nxt = tmr->hdr.next;
+					if (priv_tmr_due(tmr, now))
+					{
+						tmr->hdr.next = due;
+						due = tmr;
+					}
+					else
+					{
+						priv_tmr_hang(tmr, now);
+					}
+				}
+			}
+			slot = (slot + 1) % (OS_TIMER_WHEEL);
+		}
+		while (cnt--);
+	}
+
+	priv_tmr_rewind(now);
+	priv_tmr_merge(priv_tmr_sort(due));
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+// return time from the expiration of the timer to the nearest expiration of the object from the list, not greater than 'gap'
+static
+cnt_t priv_tmr_gap( tmr_t *tmr, hdr_t *hdr, cnt_t gap )
+{
+	tmr_t *nxt;
+	cnt_t  time;
+
+	for (nxt = hdr->next; nxt != (tmr_t *)hdr; nxt = nxt->hdr.next)
+	{
+		if (nxt->delay == INFINITE)
+			continue;
+	//	objects expiring before the timer give the time greater than 'gap'
+		time = nxt->start + nxt->delay - tmr->start - tmr->delay;
+		if (time < gap)
+			gap = time;
+	}
+
+	return gap;
+}
+
+/* -------------------------------------------------------------------------- */
+
+// shift the expiration of the timer within its slack to the nearest expiration of another object
+// then both of them are served by the same system timer interrupt
+static
+void priv_tmr_coalesce( tmr_t *tmr )
+{
+	cnt_t    gap;
+#if OS_TIMER_WHEEL
+	cnt_t    time;
+	cnt_t    span;
+	unsigned level;
+	unsigned cnt;
+	unsigned slot;
+#endif
+
+	tmr->shift = 0;
+
+	if (tmr->slack == 0 || tmr->delay == INFINITE)
+		return;
+
+	gap = priv_tmr_gap(tmr, &WAIT.hdr, tmr->slack + 1);
+#if OS_TIMER_WHEEL
+//	search the slots of the wheel covering the slack of the timer
+	time = tmr->start + tmr->delay;
+	for (level = 0; level < OS_TIMER_LEVELS; level++)
+	{
+		span = priv_tmr_span(level);
+		for (cnt = 0; cnt < OS_TIMER_WHEEL && cnt * span <= time % span + tmr->slack; cnt++)
+		{
+			slot = (priv_tmr_slot(time, level) + cnt) % (OS_TIMER_WHEEL);
+			if (WHEEL.map[level] & TMR_BIT(slot))
+				gap = priv_tmr_gap(tmr, TMR_HDR(level, slot), gap);
+		}
+	}
+#endif
+	if (gap <= tmr->slack && tmr->delay + gap != INFINITE)
+	{
+		tmr->delay += gap;
+		tmr->shift  = gap;
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
 void core_tmr_insert( tmr_t *tmr )
 {
+	priv_tmr_coalesce(tmr);
 	priv_tmr_insert(tmr);
 	port_tmr_force();
 }
@@ -113,11 +594,45 @@ void core_tmr_insert( tmr_t *tmr )
 
 void core_tmr_remove( tmr_t *tmr )
 {
+#if OS_TIMER_TASK
+	if (tmr == System.tmr) // the timer task must not restore the timer
+		System.tmr = NULL;
+#endif
 	priv_tmr_remove(tmr);
 }
 
 /* -------------------------------------------------------------------------- */
 
+tmr_t *core_tmr_next( tmr_t *tmr )
+{
+	tmr_t *nxt = tmr->hdr.next;
+#if OS_TIMER_WHEEL
+	hdr_t *hdr = &nxt->hdr;
+	unsigned slot;
+
+	if (nxt == &WAIT)
+		slot = 0;
+	else
+	if (hdr >= WHEEL.slot && hdr < WHEEL.slot + OS_TIMER_LEVELS * OS_TIMER_WHEEL)
+		slot = (unsigned)(hdr - WHEEL.slot) + 1;
+	else
+		return nxt;
+
+	for (nxt = &WAIT; slot < OS_TIMER_LEVELS * OS_TIMER_WHEEL; slot++)
+	{
+		hdr = &WHEEL.slot[slot];
+		if ((WHEEL.map[slot / (OS_TIMER_WHEEL)] & TMR_BIT(slot % (OS_TIMER_WHEEL))) && hdr->next != hdr)
+		{
+			nxt = hdr->next;
+			break;
+		}
+	}
+#endif
+	return nxt;
+}
+
+/* -------------------------------------------------------------------------- */
+
 #if HW_TIMER_SIZE
 
 static
@@ -161,18 +676,49 @@ bool priv_tmr_expired( tmr_t *tmr )
 static
 void priv_tmr_wakeup( tmr_t *tmr, unsigned event )
 {
+#if OS_TRACE_SIZE
+	core_trc_put(trcTimer, tmr, event);
+#endif
 	if (tmr->state)
 		tmr->state();
 
 	priv_tmr_remove(tmr);
 	if (tmr->delay >= (cnt_t)(core_sys_time() - tmr->start + 1))
+	{
+		priv_tmr_coalesce(tmr);
 		priv_tmr_insert(tmr);
+	}
 
 	core_all_wakeup(tmr->hdr.obj.queue, event);
 }
 
 /* -------------------------------------------------------------------------- */
 
+#if OS_TIMER_TASK
+
+// move the expired timer to the PEND queue and release the timer task
+static
+void priv_tmr_defer( tmr_t *tmr )
+{
+#if OS_TRACE_SIZE
+	core_trc_put(trcTimer, tmr, E_SUCCESS);
+#endif
+	priv_tmr_remove(tmr);
+	tmr->hdr.id = ID_TIMER; // the timer remains active until its callback procedure is executed
+	priv_rdy_insert(&tmr->hdr, &PEND);
+#ifdef DEBUG
+	if (TIMER.sp == (ctx_t *)STK_CROP(TIMER.stack, TIMER.size) - 1)
+	//	the timer task has not been run yet; fill its stack below the initial context, as core_ctx_init does
+		memset(TIMER.stack, 0xFF, (uintptr_t)TIMER.sp - (uintptr_t)TIMER.stack);
+#endif
+
+	core_tsk_wakeup(PEND.obj.queue, E_SUCCESS);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
 void core_tmr_handler( void )
 {
 	tmr_t *tmr;
@@ -181,16 +727,30 @@ void core_tmr_handler( void )
 	{
 		while (priv_tmr_expired(tmr = WAIT.hdr.next))
 		{
-			tmr->start += tmr->delay;
-
+#if OS_TIMER_WHEEL
+			if (tmr == &WHEEL.tmr)
+			{
+				priv_tmr_rotate();
+				continue;
+			}
+#endif
 			if (tmr->hdr.id == ID_TIMER)
 			{
-				tmr->delay = tmr->period;
+			//	the next period is counted from the expiration without the shift
+				tmr->start += tmr->delay - tmr->shift;
+				tmr->delay  = tmr->period;
+				tmr->shift  = 0;
+#if OS_TIMER_TASK
+				if (tmr->state)
+					priv_tmr_defer(tmr);
+				else
+#endif
 				priv_tmr_wakeup(tmr, E_SUCCESS);
 			}
 			else  /* hdr.id == ID_READY */
 			{
-				tmr->delay = 0;
+				tmr->start += tmr->delay;
+				tmr->delay  = 0;
 				core_tsk_wakeup((tsk_t *)tmr, E_TIMEOUT);
 			}
 		}
@@ -213,24 +773,144 @@ static  union  { stk_t STK[STK_SIZE(OS_IDLE_STACK)] __STKALIGN;
 #define IDLE_STK  IDLE_STACK.STK
 #define IDLE_SP  &IDLE_STACK.CTX.ctx
 
+#if OS_TIMER_TASK
+
+// timer task: executes callback procedures of the expired timers with interrupts enabled
+static
+void priv_tmr_service( void )
+{
+	tmr_t *tmr;
+	fun_t *fun;
+
+	port_set_lock();
+	{
+		while (tmr = PEND.next, tmr == (tmr_t *)&PEND)
+			core_tsk_waitFor(&PEND.obj.queue, INFINITE);
+
+		System.tmr = tmr;
+		fun = tmr->state;
+	}
+	port_clr_lock();
+
+	if (fun)
+		fun();
+
+	port_set_lock();
+	{
+		if (tmr == System.tmr) // the timer has been neither stopped nor restarted
+		{
+			System.tmr = NULL;
+			priv_tmr_remove(tmr);
+			if (tmr->delay)
+				core_tmr_insert(tmr);
+
+			core_all_wakeup(tmr->hdr.obj.queue, E_SUCCESS);
+		}
+	}
+	port_clr_lock();
+}
+
+static  union  { stk_t STK[STK_SIZE(OS_TIMER_STACK)] __STKALIGN;
+        struct { char  stk[STK_OVER(OS_TIMER_STACK)-sizeof(ctx_t)]; ctx_t ctx; } CTX; }
+        TIMER_STACK = { .CTX = { .ctx = _CTX_INIT(core_tsk_loop) } };
+#define TIMER_STK  TIMER_STACK.STK
+#define TIMER_SP  &TIMER_STACK.CTX.ctx
+
+// timer task starts in the BLOCKED queue of PEND
+tsk_t TIMER = { .hdr={ .prev=&TIMER, .next=&TIMER, .id=ID_READY }, .state=priv_tmr_service, .delay=INFINITE, .back=&PEND.obj.queue, .stack=TIMER_STK, .size=sizeof(TIMER_STK), .sp=TIMER_SP, .basic=OS_TIMER_TASK, .prio=OS_TIMER_TASK, .guard=&PEND.obj.queue, .count=1 }; // timer task
+
+#endif
+
 tsk_t MAIN = { .hdr={ .prev=&IDLE, .next=&IDLE, .id=ID_READY }, .stack=MAIN_TOP, .basic=OS_MAIN_PRIO, .prio=OS_MAIN_PRIO }; // main task
 tsk_t IDLE = { .hdr={ .prev=&MAIN, .next=&MAIN, .id=ID_READY }, .state=core_tsk_idle, .stack=IDLE_STK, .size=sizeof(IDLE_STK), .sp=IDLE_SP }; // idle task and tasks queue
+#if OS_PRIO_LEVELS
+sys_t System = { .cur=&MAIN, .map=RDY_BIT(RDY_LEVEL(OS_MAIN_PRIO)), .last={ [RDY_LEVEL(OS_MAIN_PRIO)]=&MAIN } };
+#else
 sys_t System = { .cur=&MAIN };
+#endif
 
 /* -------------------------------------------------------------------------- */
 
+#if OS_PRIO_LEVELS
+
 static
-void priv_tsk_insert( tsk_t *tsk )
+void priv_rdy_link( tsk_t *tsk, tsk_t *nxt )
+{
+	unsigned lvl = RDY_LEVEL(tsk->prio);
+
+	priv_rdy_insert(&tsk->hdr, &nxt->hdr);
+
+	if (tsk != &IDLE && (nxt == &IDLE || RDY_LEVEL(nxt->prio) != lvl))
+	{
+		System.last[lvl] = tsk;
+		System.map |= RDY_BIT(lvl);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_rdy_unlink( tsk_t *tsk )
+{
+	unsigned lvl = RDY_LEVEL(tsk->prio);
+	tsk_t  * prv = tsk->hdr.prev;
+
+	if (System.last[lvl] == tsk)
+	{
+		if (prv != &IDLE && RDY_LEVEL(prv->prio) == lvl)
+			System.last[lvl] = prv;
+		else
+		{
+			System.last[lvl] = NULL;
+			System.map &= ~RDY_BIT(lvl);
+		}
+	}
+
+	priv_rdy_remove(&tsk->hdr);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+// insert the task into the READY queue after the task 'prv' of a priority not lower than the task's one
+// &IDLE: search from the beginning of the READY queue
+static
+void priv_tsk_place( tsk_t *tsk, tsk_t *prv )
 {
 	tsk_t *nxt = &IDLE;
 #if OS_ROBIN && HW_TIMER_SIZE == 0
 	tsk->slice = 0;
+#endif
+#if OS_PRIO_LEVELS
+	if (tsk->prio < (OS_PRIO_LEVELS) - 1)
+	{
+	//	insert after the last task of the nearest non-empty level not lower than the task's one
+		uint32_t map = System.map & RDY_MASK(tsk->prio);
+		nxt = map ? System.last[core_map_first(map)]->hdr.next : IDLE.hdr.next;
+	}
+	else
 #endif
 	if (tsk->prio)
+	{
+		nxt = prv;
 		do nxt = nxt->hdr.next;
 		while (tsk->prio <= nxt->prio);
+	}
 
+#if OS_PRIO_LEVELS
+	priv_rdy_link(tsk, nxt);
+#else
 	priv_rdy_insert(&tsk->hdr, &nxt->hdr);
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tsk_insert( tsk_t *tsk )
+{
+	priv_tsk_place(tsk, &IDLE);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -238,7 +918,42 @@ void priv_tsk_insert( tsk_t *tsk )
 static
 void priv_tsk_remove( tsk_t *tsk )
 {
+#if OS_PRIO_LEVELS
+	priv_rdy_unlink(tsk);
+#else
 	priv_rdy_remove(&tsk->hdr);
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_cur_prio( tsk_t *cur, unsigned prio )
+{
+	tsk_t *nxt;
+#if OS_PRIO_LEVELS
+	if (cur->hdr.id == ID_READY && cur->guard == 0)
+	{
+	//	the READY queue must remain sorted, so the current task is moved
+		priv_tsk_remove(cur);
+		cur->prio = prio;
+		nxt = IDLE.hdr.next;
+		if (nxt->prio > prio)
+		{
+			priv_tsk_insert(cur);
+			port_ctx_switch();
+		}
+		else
+		{
+			priv_rdy_link(cur, nxt);
+		}
+		return;
+	}
+#endif
+	cur->prio = prio;
+	nxt = cur->hdr.next;
+	if (nxt->prio > prio)
+		port_ctx_switch();
 }
 
 /* -------------------------------------------------------------------------- */
@@ -280,7 +995,7 @@ void core_ctx_init( tsk_t *tsk )
 size_t core_stk_space( tsk_t *tsk )
 {
 	void *stk = tsk->stack;
-	char *ptr = stk;
+	uint8_t *ptr = stk;
 	while (*ptr == 0xFF) ptr++;
 	return (uintptr_t)ptr - (uintptr_t)stk;
 }
@@ -292,21 +1007,21 @@ bool priv_stk_integrity( tsk_t *tsk, void *tp, void *sp)
 	if (sp < tp) return false;
 #if (__MPU_USED == 0) && ((OS_GUARD_SIZE) > 0)
 	if (tsk == &IDLE) return true;
-	if (core_stk_space(tsk) < STK_OVER(0)) return false;
+	if (core_stk_space(tsk) < ALIGNED(OS_GUARD_SIZE, sizeof(stk_t))) return false;
 #endif
 	return true;
 }
 
 bool core_ctx_integrity( tsk_t *tsk, void *sp )
 {
-	void *tp = tsk->stack + STK_SIZE(0);
+	void *tp = tsk->stack + ALIGNED_SIZE(OS_GUARD_SIZE, sizeof(stk_t));
 	return priv_stk_integrity(tsk, tp, sp);
 }
 
 bool core_stk_integrity( void )
 {
 	tsk_t *tsk = System.cur;
-	void *tp = tsk->stack + STK_SIZE(sizeof(ctx_t));
+	void *tp = tsk->stack + ALIGNED_SIZE(sizeof(ctx_t) + (OS_GUARD_SIZE), sizeof(stk_t));
 	void *sp = port_get_sp();
 	return priv_stk_integrity(tsk, tp, sp);
 }
@@ -340,6 +1055,7 @@ void core_tsk_loop( void )
 void core_tsk_append( tsk_t *tsk, tsk_t **que )
 {
 	tsk_t *nxt = *que;
+	unsigned cnt = core_tsk_count(nxt) + 1;
 	tsk->guard  = que;
 	tsk->hdr.id = ID_READY;
 
@@ -354,6 +1070,8 @@ void core_tsk_append( tsk_t *tsk, tsk_t **que )
 	tsk->back = que;
 	tsk->hdr.obj.queue = nxt;
 	*que = tsk;
+
+	(*tsk->guard)->count = cnt; // the first task keeps the count of the queue
 }
 
 /* -------------------------------------------------------------------------- */
@@ -362,12 +1080,17 @@ void core_tsk_unlink( tsk_t *tsk, unsigned event )
 {
 	tsk_t**que = tsk->back;
 	tsk_t *nxt = tsk->hdr.obj.queue;
+	tsk_t**hdr = tsk->guard;
+	unsigned cnt = core_tsk_count(*hdr) - 1;
 	tsk->event = event;
 	tsk->guard = 0;
 
 	if (nxt)
 		nxt->back = que;
 	*que = nxt;
+
+	if (*hdr)
+		(*hdr)->count = cnt; // the first task keeps the count of the queue
 }
 
 /* -------------------------------------------------------------------------- */
@@ -380,14 +1103,32 @@ void core_tsk_transfer( tsk_t *tsk, tsk_t **que )
 
 /* -------------------------------------------------------------------------- */
 
+void core_tsk_requeue( tsk_t *tsk, tsk_t **que )
+{
+#if OS_TRACE_SIZE
+	core_trc_put(trcWait, tsk, (uintptr_t)que);
+#endif
+	core_tsk_unlink(tsk, tsk->event);
+	priv_tmr_remove((tmr_t *)tsk);
+	tsk->delay = INFINITE;
+	priv_tmr_insert((tmr_t *)tsk); // sets ID_TIMER awhile
+	core_tsk_append(tsk, que); // must be last; sets ID_READY
+}
+
+/* -------------------------------------------------------------------------- */
+
 unsigned core_tsk_wait( tsk_t *tsk, tsk_t **que, bool yield )
 {
 	assert_tsk_context();
 
 	if (que)
 	{
+#if OS_TRACE_SIZE
+		core_trc_put(trcWait, tsk, (uintptr_t)que);
+#endif
 		priv_tsk_remove(tsk);
-		core_tmr_insert((tmr_t *)tsk); // sets ID_TIMER awhile
+		priv_tmr_insert((tmr_t *)tsk); // sets ID_TIMER awhile; task has no slack
+		port_tmr_force();
 		core_tsk_append(tsk, que); // must be last; sets ID_READY
 	}
 
@@ -456,6 +1197,9 @@ tsk_t *core_tsk_wakeup( tsk_t *tsk, unsigned event )
 {
 	if (tsk)
 	{
+#if OS_TRACE_SIZE
+		core_trc_put(trcWakeup, tsk, event);
+#endif
 		core_tsk_unlink(tsk, event);
 		priv_tmr_remove((tmr_t *)tsk);
 		core_tsk_insert(tsk);
@@ -468,18 +1212,32 @@ tsk_t *core_tsk_wakeup( tsk_t *tsk, unsigned event )
 
 void core_all_wakeup( tsk_t *tsk, unsigned event )
 {
-	while (tsk = core_tsk_wakeup(tsk, event), tsk) tsk = tsk->hdr.obj.queue;
+	tsk_t *fst = tsk;
+	tsk_t *prv = &IDLE;
+	tsk_t *nxt;
+
+//	BLOCKED queue is sorted by priority, so every next task is inserted into the READY queue after the previous one
+	for (; tsk; prv = tsk, tsk = nxt)
+	{
+		nxt = tsk->hdr.obj.queue;
+#if OS_TRACE_SIZE
+		core_trc_put(trcWakeup, tsk, event);
+#endif
+		core_tsk_unlink(tsk, event);
+		priv_tmr_remove((tmr_t *)tsk);
+		tsk->hdr.id = ID_READY;
+		priv_tsk_place(tsk, prv);
+	}
+
+	if (fst && fst == IDLE.hdr.next)
+		port_ctx_switch();
 }
 
 /* -------------------------------------------------------------------------- */
 
 unsigned core_tsk_count( tsk_t *tsk )
 {
-	unsigned cnt = 0;
-
-	while (tsk) { cnt++; tsk = tsk->hdr.obj.queue; }
-
-	return cnt;
+	return tsk ? tsk->count : 0;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -498,17 +1256,14 @@ void core_tsk_prio( tsk_t *tsk, unsigned prio )
 
 	if (tsk->prio != prio)
 	{
-		tsk->prio = prio;
-
 		if (tsk == System.cur)       // current task
 		{
-			tsk = tsk->hdr.next;
-			if (tsk->prio > prio)
-				port_ctx_switch();
+			priv_cur_prio(tsk, prio);
 		}
 		else
 		if (tsk->guard != 0)         // blocked task
 		{
+			tsk->prio = prio;
 			core_tsk_transfer(tsk, tsk->guard);
 			if (tsk->mtx.tree)
 				core_tsk_prio(tsk->mtx.tree->owner, prio);
@@ -517,8 +1272,13 @@ void core_tsk_prio( tsk_t *tsk, unsigned prio )
 		if (tsk->hdr.id == ID_READY) // ready task
 		{
 			priv_tsk_remove(tsk);
+			tsk->prio = prio;
 			core_tsk_insert(tsk);
 		}
+		else                         // stopped task
+		{
+			tsk->prio = prio;
+		}
 	}
 }
 
@@ -538,12 +1298,7 @@ void core_cur_prio( unsigned prio )
 				prio = mtx->obj.queue->prio;
 
 	if (tsk->prio != prio)
-	{
-		tsk->prio = prio;
-		tsk = tsk->hdr.next;
-		if (tsk->prio > prio)
-			port_ctx_switch();
-	}
+		priv_cur_prio(tsk, prio);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -558,12 +1313,22 @@ void *core_tsk_handler( void *sp )
 	{
 		core_ctx_reset();
 
+#if OS_TASK_STATS
+		core_tsk_time();
+#endif
 		cur = System.cur;
 		if (cur->sp == 0)
 			cur->sp = sp;
 
 		nxt = IDLE.hdr.next;
 
+		if (System.lock && cur->hdr.id == ID_READY && cur->guard == 0)
+		{
+		//	scheduler is locked and the current task is still ready; the context switch is deferred
+			System.pend = true;
+			nxt = cur;
+		}
+		else
 #if OS_ROBIN && HW_TIMER_SIZE == 0
 		if (cur == nxt || (nxt->slice >= (OS_FREQUENCY)/(OS_ROBIN) && (nxt->slice = 0) == 0))
 #else
@@ -575,6 +1340,10 @@ void *core_tsk_handler( void *sp )
 			nxt = IDLE.hdr.next;
 		}
 
+#if OS_TRACE_SIZE
+		if (nxt != cur)
+			core_trc_put(trcSwitch, nxt, (uintptr_t)cur);
+#endif
 		System.cur = nxt;
 		sp = nxt->sp;
 		nxt->sp = 0;
@@ -592,6 +1361,31 @@ void *core_tsk_handler( void *sp )
 	return sp;
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_TASK_STATS
+
+void core_tsk_time( void )
+{
+	uint32_t stamp = core_cyc_time();
+	uint64_t time  = stamp - System.stamp;
+#if HW_TIMER_SIZE || OS_TICKLESS_IDLE
+//	in tick-less mode (or while the ticks are suppressed in the idle task) the run time may not be updated for more than one period of the cycle counter
+//	the whole periods lost are restored with the system timer
+	cnt_t    start = core_sys_time();
+	cnt_t    delta = start - System.start;
+	uint64_t cycles = (uint64_t)(delta / (OS_FREQUENCY)) * (CYC_FREQUENCY) + (uint64_t)(delta % (OS_FREQUENCY)) * (CYC_FREQUENCY) / (OS_FREQUENCY);
+
+	time += (cycles - time + 0x80000000U) & ~(uint64_t)UINT32_MAX;
+	System.start = start;
+#endif
+	System.stamp = stamp;
+	System.time += time;
+	System.cur->time += time;
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 // SYSTEM MUTEX SERVICES
 /* -------------------------------------------------------------------------- */
@@ -667,6 +1461,9 @@ void core_mtx_reset( mtx_t *mtx, unsigned event )
 void core_sys_tick( void )
 {
 	System.cnt++;
+	#if OS_TASK_STATS
+	core_tsk_time();
+	#endif
 	core_tmr_handler();
 	#if OS_ROBIN
 	if (++System.cur->slice >= (OS_FREQUENCY)/(OS_ROBIN))
@@ -678,8 +1475,47 @@ void core_sys_tick( void )
 
 /* -------------------------------------------------------------------------- */
 
+#if HW_TIMER_SIZE == 0 && OS_TICKLESS_IDLE
+
+// number of ticks remaining to the expiration of the nearest timer
+static
+cnt_t priv_tmr_delay( void )
+{
+	tmr_t *tmr  = WAIT.hdr.next;
+	cnt_t  time = System.cnt - tmr->start;
+
+	if (tmr->delay == INFINITE)
+		return INFINITE;
+
+	if (tmr->delay <= time)
+		return 0;
+
+	return tmr->delay - time;
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
 void core_tsk_idle( void )
 {
+#if HW_TIMER_SIZE == 0 && OS_TICKLESS_IDLE
+	cnt_t delay = 0;
+
+	port_set_lock();
+	{
+		if (IDLE.hdr.next == &IDLE) // there is no other task ready to run
+			delay = priv_tmr_delay();
+
+		if (delay > 1)
+	//	system timer interrupts are suppressed until the tick preceding the expiration of the nearest timer
+			System.cnt += port_sys_sleep(delay - 1 < UINT32_MAX ? (uint32_t)(delay - 1) : UINT32_MAX);
+	}
+	port_clr_lock();
+
+	if (delay > 1)
+		return;
+#endif
 	__WFI();
 }
 
@@ -2,7 +2,7 @@
 
     @file    StateOS: oskernel.h
     @author  Rajmund Szymanski
-    @date    06.06.2020
+    @date    18.10.2026
     @brief   This file defines set of kernel functions for StateOS.
 
  ******************************************************************************
@@ -82,6 +82,9 @@ extern "C" {
 extern tsk_t MAIN;   // main task
 extern tsk_t IDLE;   // idle task, tasks' queue
 extern tmr_t WAIT;   // timers' queue
+#if OS_TIMER_TASK
+extern tsk_t TIMER;  // timer task
+#endif
 extern sys_t System; // system data
 
 /* -------------------------------------------------------------------------- */
@@ -114,6 +117,24 @@ bool core_stk_integrity( void );
 #endif
 void port_sys_init( void );
 
+/* -------------------------------------------------------------------------- */
+#if OS_LOCK_TRACE
+
+// start measurement of the critical section entered at 'line' of 'file'
+// return true if the measurement has been started (the section is not nested)
+bool core_cri_enter( const char *file, unsigned line );
+
+// finish measurement of the critical section started with result 'trace'
+void core_cri_leave( bool trace );
+
+// interrupts are going to be unlocked inside the critical section; pause the measurement
+// return the paused measurement
+void *core_cri_suspend( void );
+
+// interrupts have been locked again; resume the measurement 'cri'
+void core_cri_resume( void *cri );
+
+#endif
 /* -------------------------------------------------------------------------- */
 
 // initiate task 'tsk' for context switch
@@ -126,6 +147,9 @@ void core_ctx_switch( void );
 __STATIC_INLINE
 void core_ctx_switchNow( void )
 {
+#if OS_LOCK_TRACE
+	core_cri_suspend();
+#endif
 	core_ctx_switch();
 	port_clr_lock(); __ISB();
 }
@@ -143,7 +167,8 @@ void core_ctx_reset( void )
 
 /* -------------------------------------------------------------------------- */
 
-// insert task / timer 'tmr' into timers READY queue
+// insert timer 'tmr' into timers READY queue
+// expiration of the timer may be shifted within its slack to the expiration of another task / timer
 void core_tmr_insert( tmr_t *tmr );
 
 // remove task / timer 'tmr' from timers READY queue
@@ -152,6 +177,10 @@ void core_tmr_remove( tmr_t *tmr );
 // timers queue handler procedure
 void core_tmr_handler( void );
 
+// return task / timer following 'tmr' in timers READY queue, including slots of the timing wheel
+// core_tmr_next(&WAIT) returns the first one, &WAIT follows the last one
+tmr_t *core_tmr_next( tmr_t *tmr );
+
 /* -------------------------------------------------------------------------- */
 
 // reset stack and restart the current task
@@ -174,6 +203,10 @@ void core_tsk_unlink( tsk_t *tsk, unsigned event );
 // transfer task 'tsk' to the blocked queue 'que'
 void core_tsk_transfer( tsk_t *tsk, tsk_t **que );
 
+// move blocked task 'tsk' to the blocked queue 'que' without releasing it
+// the task waits in the blocked queue 'que' indefinitely
+void core_tsk_requeue( tsk_t *tsk, tsk_t **que );
+
 // delay execution of current task for given duration of time 'delay'
 // append the current task to the blocked queue 'que'
 // remove the current task from tasks READY queue
@@ -236,11 +269,23 @@ tsk_t *core_one_wakeup( tsk_t *tsk, unsigned event )
 // resume execution of all tasks from blocked queue with event value 'event'; 'tsk' is the head (first task) of the queue
 // remove all resumed tasks from guard object blocked queue
 // remove all resumed tasks from timers READY queue
-// insert all resumed tasks into tasks READY queue
-// force context switch if priority of any resumed task is greater then priority of the current task and kernel works in preemptive mode
+// insert all resumed tasks into tasks READY queue in one pass
+// force context switch (once) if priority of any resumed task is greater then priority of the current task and kernel works in preemptive mode
 void core_all_wakeup( tsk_t *tsk, unsigned event );
 
-// return count of tasks blocked on the queue; 'tsk' is the head (first task) of the queue
+// resume execution of all tasks waiting for multiple objects (sel_wait) including the object 'obj' that has become ready
+// resumed task gets the index of the object 'obj' in its list as the event value
+void core_sel_wakeup( void *obj );
+
+// resume execution of tasks waiting for multiple objects if the object 'obj' has become ready
+__STATIC_INLINE
+void core_sel_notify( void *obj )
+{
+	if (System.sel)
+		core_sel_wakeup(obj);
+}
+
+// return count of tasks blocked on the queue in constant time; 'tsk' is the head (first task) of the queue
 unsigned core_tsk_count( tsk_t *tsk );
 
 // set task 'tsk' priority
@@ -257,6 +302,13 @@ void core_cur_prio( unsigned prio );
 // return a pointer to the stack pointer of the next READY task the highest priority
 void *core_tsk_handler( void *sp );
 
+#if OS_TASK_STATS
+// add the time elapsed since the last update to the run time of the current task
+// it is updated at every context switch and at every tick of the system timer (non-tick-less mode only)
+// in tick-less mode and with OS_TICKLESS_IDLE the whole periods of the cycle counter elapsed since the last update are restored with the system timer
+void core_tsk_time( void );
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 // set the task 'tsk' as the owner of the mutex 'mtx'
@@ -306,6 +358,43 @@ void core_sys_tick( void )
 
 /* -------------------------------------------------------------------------- */
 
+// return current value of the cycle counter
+// the system timer is used if the port does not provide the cycle counter
+__STATIC_INLINE
+uint32_t core_cyc_time( void )
+{
+#ifdef  CYC_FREQUENCY
+	return port_cyc_time();
+#else
+	return (uint32_t)core_sys_time();
+#endif
+}
+
+#ifndef CYC_FREQUENCY
+#define CYC_FREQUENCY (OS_FREQUENCY)
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+// return index of the most significant bit set in the bitmap 'map' (map != 0)
+__STATIC_INLINE
+unsigned core_map_first( uint32_t map )
+{
+#if   defined(__GNUC__)
+	return (unsigned)__builtin_clz(map); // CLZ instruction on Cortex-M3 and above
+#elif defined(__ICCARM__)
+	return (unsigned)__CLZ(map);
+#elif defined(__CC_ARM)
+	return (unsigned)__clz(map);
+#else
+	unsigned idx = 0;
+	while ((map & 0x80000000UL) == 0) { map <<= 1; idx++; }
+	return idx;
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+
 // default idle procedure
 void core_tsk_idle( void );
 
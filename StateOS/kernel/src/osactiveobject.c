@@ -0,0 +1,352 @@
+/******************************************************************************
+
+    @file    StateOS: osactiveobject.c
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "inc/osactiveobject.h"
+#include "inc/oscriticalsection.h"
+
+/* -------------------------------------------------------------------------- */
+aev_t *aev_alloc( mem_t *mem, unsigned signal )
+/* -------------------------------------------------------------------------- */
+{
+	aev_t *aev = NULL;
+
+	assert(mem);
+	assert(mem->size * sizeof(que_t) >= sizeof(aev_t));
+
+	if (mem_take(mem, (void **)&aev) == E_SUCCESS)
+	{
+		aev->signal = signal;
+		aev->refs   = 0;
+		aev->mem    = mem;
+	}
+
+	return aev;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_aev_hold( const aev_t *aev )
+/* -------------------------------------------------------------------------- */
+{
+	if (aev->mem)
+		((aev_t *)aev)->refs++;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_aev_release( const aev_t *aev )
+/* -------------------------------------------------------------------------- */
+{
+//	recycle the dynamic event when the last reference has been released
+	if (aev->mem && --((aev_t *)aev)->refs == 0)
+		mem_give(aev->mem, aev);
+}
+
+/* -------------------------------------------------------------------------- */
+void aob_init( aob_t *aob, evh_t *handler, void *data, size_t bufsize )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(aob);
+	assert(handler);
+	assert(data);
+	assert(bufsize);
+
+	sys_lock();
+	{
+		box_init(&aob->box, sizeof(aev_t *), data, bufsize);
+		aob->proc = handler;
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void aob_reset( aob_t *aob )
+/* -------------------------------------------------------------------------- */
+{
+	const aev_t *aev;
+
+	assert_tsk_context();
+	assert(aob);
+
+	sys_lock();
+	{
+		while (box_take(&aob->box, &aev) == E_SUCCESS)
+			priv_aev_release(aev);
+		box_reset(&aob->box);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_aob_post( aob_t *aob, const aev_t *aev )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event;
+
+	priv_aev_hold(aev);
+	event = box_give(&aob->box, &aev);
+	if (event != E_SUCCESS)
+		priv_aev_release(aev);
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned aob_post( aob_t *aob, const aev_t *aev )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event;
+
+	assert(aob);
+	assert(aev);
+
+	sys_lock();
+	{
+		event = priv_aob_post(aob, aev);
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_aob_dispatch( aob_t *aob, const aev_t *aev )
+/* -------------------------------------------------------------------------- */
+{
+	aob->proc(aob, aev);
+
+	sys_lock();
+	{
+		priv_aev_release(aev);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned aob_take( aob_t *aob )
+/* -------------------------------------------------------------------------- */
+{
+	const aev_t *aev;
+	unsigned event;
+
+	assert_tsk_context();
+	assert(aob);
+
+	event = box_take(&aob->box, &aev);
+	if (event == E_SUCCESS)
+		priv_aob_dispatch(aob, aev);
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned aob_waitFor( aob_t *aob, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	const aev_t *aev;
+	unsigned event;
+
+	assert_tsk_context();
+	assert(aob);
+
+	event = box_waitFor(&aob->box, &aev, delay);
+	if (event == E_SUCCESS)
+		priv_aob_dispatch(aob, aev);
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned aob_waitUntil( aob_t *aob, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	const aev_t *aev;
+	unsigned event;
+
+	assert_tsk_context();
+	assert(aob);
+
+	event = box_waitUntil(&aob->box, &aev, time);
+	if (event == E_SUCCESS)
+		priv_aob_dispatch(aob, aev);
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+void bus_init( bus_t *bus, uint32_t *subs, unsigned limit )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(bus);
+	assert(subs);
+	assert(limit);
+
+	sys_lock();
+	{
+		memset(bus, 0, sizeof(bus_t));
+		memset(subs, 0, limit * sizeof(uint32_t));
+
+		bus->limit = limit;
+		bus->subs  = subs;
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned bus_subscribe( bus_t *bus, aob_t *aob, unsigned signal )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event = E_FAILURE;
+	unsigned i;
+
+	assert_tsk_context();
+	assert(bus);
+	assert(aob);
+	assert(signal < bus->limit);
+
+	sys_lock();
+	{
+		for (i = 0; i < BUS_LIMIT; i++)
+			if (bus->list[i] == aob)
+				break;
+
+		if (i == BUS_LIMIT)
+			for (i = 0; i < BUS_LIMIT; i++)
+				if (bus->list[i] == NULL)
+					break;
+
+		if (i < BUS_LIMIT)
+		{
+			bus->list[i] = aob;
+			bus->subs[signal] |= UINT32_C(1) << i;
+			event = E_SUCCESS;
+		}
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+void bus_unsubscribe( bus_t *bus, aob_t *aob, unsigned signal )
+/* -------------------------------------------------------------------------- */
+{
+	uint32_t mask;
+	unsigned i, s;
+
+	assert_tsk_context();
+	assert(bus);
+	assert(aob);
+	assert(signal < bus->limit);
+
+	sys_lock();
+	{
+		for (i = 0; i < BUS_LIMIT; i++)
+		{
+			if (bus->list[i] == aob)
+			{
+				mask = UINT32_C(1) << i;
+				bus->subs[signal] &= ~mask;
+			//	release the entry of the active object not subscribed to any signal
+				for (s = 0; s < bus->limit; s++)
+					if (bus->subs[s] & mask)
+						break;
+				if (s == bus->limit)
+					bus->list[i] = NULL;
+				break;
+			}
+		}
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned bus_publish( bus_t *bus, const aev_t *aev )
+/* -------------------------------------------------------------------------- */
+{
+	uint32_t subs;
+	unsigned count = 0;
+	unsigned i;
+
+	assert(bus);
+	assert(aev);
+	assert(aev->signal < bus->limit);
+
+	sys_lock();
+	{
+	//	hold the event until it is posted to all the subscribers
+		priv_aev_hold(aev);
+
+		for (subs = bus->subs[aev->signal], i = 0; subs; subs >>= 1, i++)
+			if ((subs & 1) && priv_aob_post(bus->list[i], aev) == E_SUCCESS)
+				count++;
+
+		priv_aev_release(aev);
+	}
+	sys_unlock();
+
+	return count;
+}
+
+/* -------------------------------------------------------------------------- */
+void tev_init( tev_t *tev, aob_t *aob, unsigned signal )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(tev);
+	assert(aob);
+
+	sys_lock();
+	{
+		tmr_init(&tev->tmr, core_tev_handler);
+
+		tev->aev.signal = signal;
+		tev->aev.refs   = 0;
+		tev->aev.mem    = NULL;
+		tev->aob        = aob;
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void core_tev_handler( void )
+/* -------------------------------------------------------------------------- */
+{
+	tev_t *tev = (tev_t *) tmr_thisISR();
+
+	aob_post(tev->aob, &tev->aev);
+}
+
+/* -------------------------------------------------------------------------- */
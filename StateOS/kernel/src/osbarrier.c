@@ -2,7 +2,7 @@
 
     @file    StateOS: osbarrier.c
     @author  Rajmund Szymanski
-    @date    06.06.2020
+    @date    18.10.2026
     @brief   This file provides set of functions for StateOS.
 
  ******************************************************************************
@@ -68,13 +68,13 @@ bar_t *bar_create( unsigned limit )
 	assert_tsk_context();
 	assert(limit);
 
-	sys_lock();
+	sys_schedLock();
 	{
 		bar = malloc(sizeof(bar_t));
 		if (bar)
 			priv_bar_init(bar, limit, bar);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return bar;
 }
@@ -2,7 +2,7 @@
 
     @file    StateOS: osconditionvariable.c
     @author  Rajmund Szymanski
-    @date    06.06.2020
+    @date    18.10.2026
     @brief   This file provides set of functions for StateOS.
 
  ******************************************************************************
@@ -30,6 +30,7 @@
  ******************************************************************************/
 
 #include "inc/osconditionvariable.h"
+#include "inc/ostask.h"
 #include "inc/oscriticalsection.h"
 
 /* -------------------------------------------------------------------------- */
@@ -64,13 +65,13 @@ cnd_t *cnd_create( void )
 
 	assert_tsk_context();
 
-	sys_lock();
+	sys_schedLock();
 	{
 		cnd = malloc(sizeof(cnd_t));
 		if (cnd)
 			priv_cnd_init(cnd, cnd);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return cnd;
 }
@@ -132,10 +133,19 @@ unsigned cnd_waitFor( cnd_t *cnd, mtx_t *mtx, cnt_t delay )
 		event = mtx_give(mtx);
 		if (event == E_SUCCESS)
 		{
+			System.cur->tmp.cnd.mtx = mtx;
 			wait_event = core_tsk_waitFor(&cnd->obj.queue, delay);
-			event = mtx_wait(mtx);
-			if (event == E_SUCCESS)
+			if (System.cur->mtx.tree == mtx) // the task has been moved to the mutex and has already taken it
+			{
+				System.cur->mtx.tree = 0;
 				event = wait_event;
+			}
+			else
+			{
+				event = mtx_wait(mtx);
+				if (event == E_SUCCESS)
+					event = wait_event;
+			}
 		}
 	}
 	sys_unlock();
@@ -161,10 +171,19 @@ unsigned cnd_waitUntil( cnd_t *cnd, mtx_t *mtx, cnt_t time )
 		event = mtx_give(mtx);
 		if (event == E_SUCCESS)
 		{
+			System.cur->tmp.cnd.mtx = mtx;
 			wait_event = core_tsk_waitUntil(&cnd->obj.queue, time);
-			event = mtx_wait(mtx);
-			if (event == E_SUCCESS)
+			if (System.cur->mtx.tree == mtx) // the task has been moved to the mutex and has already taken it
+			{
+				System.cur->mtx.tree = 0;
 				event = wait_event;
+			}
+			else
+			{
+				event = mtx_wait(mtx);
+				if (event == E_SUCCESS)
+					event = wait_event;
+			}
 		}
 	}
 	sys_unlock();
@@ -172,16 +191,62 @@ unsigned cnd_waitUntil( cnd_t *cnd, mtx_t *mtx, cnt_t time )
 	return event;
 }
 
+/* -------------------------------------------------------------------------- */
+static
+bool priv_cnd_morph( tsk_t *tsk )
+/* -------------------------------------------------------------------------- */
+{
+	mtx_t *mtx = tsk->tmp.cnd.mtx;
+
+	if (mtx->owner == tsk || (mtx->mode & mtxInconsistent) ||
+	  ((mtx->mode & mtxPrioMASK) == mtxPrioProtect && mtx->prio < tsk->prio))
+		return false;
+
+	if (mtx->owner == 0)
+	{
+	//	the mutex is free, so it is handed over to the task, which has to be released
+		core_mtx_link(mtx, tsk);
+		tsk->mtx.tree = mtx;
+		return false;
+	}
+
+//	wait morphing: the mutex is locked, so the task is moved directly to the BLOCKED queue of the mutex
+	if ((mtx->mode & mtxPrioMASK) != mtxPrioNone && mtx->owner->prio < tsk->prio)
+		core_tsk_prio(mtx->owner, tsk->prio);
+
+	tsk->mtx.tree = mtx;
+	core_tsk_requeue(tsk, &mtx->obj.queue);
+	return true;
+}
+
 /* -------------------------------------------------------------------------- */
 void cnd_give( cnd_t *cnd, bool all )
 /* -------------------------------------------------------------------------- */
 {
+	tsk_t *tsk;
+	tsk_t *nxt;
+
 	assert(cnd);
 	assert(cnd->obj.res!=RELEASED);
 
 	sys_lock();
 	{
-		while (core_one_wakeup(cnd->obj.queue, E_SUCCESS) && all);
+		if (all)
+		{
+		//	only the first task waiting for each mutex is released, the others are moved to the mutex
+			for (tsk = cnd->obj.queue; tsk; tsk = nxt)
+			{
+				nxt = tsk->hdr.obj.queue;
+				priv_cnd_morph(tsk);
+			}
+			core_all_wakeup(cnd->obj.queue, E_SUCCESS);
+		}
+		else
+		{
+			tsk = cnd->obj.queue;
+			if (tsk && !priv_cnd_morph(tsk))
+				core_one_wakeup(tsk, E_SUCCESS);
+		}
 	}
 	sys_unlock();
 }
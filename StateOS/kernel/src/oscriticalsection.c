@@ -0,0 +1,197 @@
+/******************************************************************************
+
+    @file    StateOS: oscriticalsection.c
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "inc/oscriticalsection.h"
+
+#if OS_LOCK_TRACE
+
+/* -------------------------------------------------------------------------- */
+
+static cri_t     CRI[OS_LOCK_TRACE]; // table of the critical section statistics
+static cri_t     CRI_LOST;           // sections not fitting into the table are measured here
+static cri_t   * CRI_CUR;            // currently measured critical section
+static uint32_t  CRI_START;          // start time of the current measurement
+
+/* -------------------------------------------------------------------------- */
+static
+cri_t *priv_cri_find( const char *file, unsigned line )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned idx = (unsigned)(((uintptr_t)file ^ line) % (OS_LOCK_TRACE));
+	unsigned cnt;
+	cri_t  * cri;
+
+	for (cnt = 0; cnt < (OS_LOCK_TRACE); cnt++)
+	{
+		cri = &CRI[idx];
+		if (cri->file == NULL)
+		{
+			cri->file = file;
+			cri->line = line;
+			return cri;
+		}
+		if (cri->file == file && cri->line == line)
+			return cri;
+		if (++idx == (OS_LOCK_TRACE))
+			idx = 0;
+	}
+
+	return &CRI_LOST;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_cri_update( cri_t *cri, uint32_t time )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned bin = 0;
+
+	cri->count++;
+	if (cri->max < time)
+		cri->max = time;
+
+	for (time >>= 6; time && bin < CRI_BINS - 1; time >>= 1)
+		bin++;
+	cri->hist[bin]++;
+}
+
+/* -------------------------------------------------------------------------- */
+bool core_cri_enter( const char *file, unsigned line )
+/* -------------------------------------------------------------------------- */
+{
+	if (CRI_CUR)
+		return false;
+
+	CRI_CUR = priv_cri_find(file, line);
+	CRI_START = core_cyc_time();
+
+	return true;
+}
+
+/* -------------------------------------------------------------------------- */
+void core_cri_leave( bool trace )
+/* -------------------------------------------------------------------------- */
+{
+	uint32_t time = core_cyc_time() - CRI_START;
+
+	if (trace && CRI_CUR)
+	{
+		priv_cri_update(CRI_CUR, time);
+		CRI_CUR = NULL;
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+void *core_cri_suspend( void )
+/* -------------------------------------------------------------------------- */
+{
+	uint32_t time = core_cyc_time() - CRI_START;
+	cri_t  * cri  = CRI_CUR;
+
+	if (cri)
+	{
+		priv_cri_update(cri, time);
+		CRI_CUR = NULL;
+	}
+
+	return cri;
+}
+
+/* -------------------------------------------------------------------------- */
+void core_cri_resume( void *cri )
+/* -------------------------------------------------------------------------- */
+{
+	if (cri)
+	{
+		CRI_CUR = cri;
+		CRI_START = core_cyc_time();
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned sys_lockStats( cri_t *table, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned idx;
+	unsigned cnt = 0;
+
+	assert(table || count == 0);
+
+	sys_lock();
+	{
+		for (idx = 0; idx < (OS_LOCK_TRACE) && cnt < count; idx++)
+			if (CRI[idx].file)
+				table[cnt++] = CRI[idx];
+	//	sections not fitting into the table are returned as the last record
+		if (CRI_LOST.count && cnt < count)
+			table[cnt++] = CRI_LOST;
+	}
+	sys_unlock();
+
+	return cnt;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_LOCK_TRACE
+
+/* -------------------------------------------------------------------------- */
+void sys_schedLock( void )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+
+	sys_lock();
+	{
+		System.lock++;
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void sys_schedUnlock( void )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(System.lock);
+
+	sys_lock();
+	{
+		if (--System.lock == 0 && System.pend)
+		{
+			System.pend = false;
+			port_ctx_switch();
+		}
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
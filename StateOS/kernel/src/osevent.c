@@ -2,7 +2,7 @@
 
     @file    StateOS: osevent.c
     @author  Rajmund Szymanski
-    @date    06.06.2020
+    @date    18.10.2026
     @brief   This file provides set of functions for StateOS.
 
  ******************************************************************************
@@ -65,13 +65,13 @@ evt_t *evt_create( void )
 
 	assert_tsk_context();
 
-	sys_lock();
+	sys_schedLock();
 	{
 		evt = malloc(sizeof(evt_t));
 		if (evt)
 			priv_evt_init(evt, evt);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return evt;
 }
@@ -168,11 +168,10 @@ void evt_give( evt_t *evt, unsigned data )
 
 	sys_lock();
 	{
-		while ((tsk = evt->obj.queue) != 0)
-		{
+		for (tsk = evt->obj.queue; tsk; tsk = tsk->hdr.obj.queue)
 			*tsk->tmp.evt.data = data;
-			core_tsk_wakeup(tsk, E_SUCCESS);
-		}
+
+		core_all_wakeup(evt->obj.queue, E_SUCCESS);
 	}
 	sys_unlock();
 }
@@ -2,7 +2,7 @@
 
     @file    StateOS: oseventqueue.c
     @author  Rajmund Szymanski
-    @date    06.06.2020
+    @date    18.10.2026
     @brief   This file provides set of functions for StateOS.
 
  ******************************************************************************
@@ -32,6 +32,7 @@
 #include "inc/oseventqueue.h"
 #include "inc/ostask.h"
 #include "inc/oscriticalsection.h"
+#include "inc/ostrace.h"
 
 /* -------------------------------------------------------------------------- */
 static
@@ -73,14 +74,14 @@ evq_t *evq_create( unsigned limit )
 	assert_tsk_context();
 	assert(limit);
 
-	sys_lock();
+	sys_schedLock();
 	{
 		bufsize = limit * sizeof(unsigned);
 		tmp = malloc(sizeof(struct evq_T) + bufsize);
 		if (tmp)
 			priv_evq_init(evq = &tmp->evq, tmp->buf, bufsize, tmp);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return evq;
 }
@@ -186,6 +187,7 @@ void priv_evq_putUpdate( evq_t *evq, const unsigned data )
 	priv_evq_put(evq, data);
 	tsk = core_one_wakeup(evq->obj.queue, E_SUCCESS);
 	if (tsk) priv_evq_get(evq, tsk->tmp.evq.data.in);
+	else     core_sel_notify(evq);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -211,6 +213,9 @@ unsigned priv_evq_take( evq_t *evq, unsigned *data )
 	if (evq->count > 0)
 	{
 		priv_evq_getUpdate(evq, data);
+#if OS_TRACE_SIZE
+		core_trc_put(trcTake, evq, (uintptr_t)System.cur);
+#endif
 		return E_SUCCESS;
 	}
 
@@ -302,6 +307,9 @@ unsigned priv_evq_give( evq_t *evq, unsigned data )
 	if (evq->count < evq->limit)
 	{
 		priv_evq_putUpdate(evq, data);
+#if OS_TRACE_SIZE
+		core_trc_put(trcGive, evq, (uintptr_t)System.cur);
+#endif
 		return E_SUCCESS;
 	}
 
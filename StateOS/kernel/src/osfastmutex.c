@@ -2,7 +2,7 @@
 
     @file    StateOS: osfastmutex.c
     @author  Rajmund Szymanski
-    @date    06.06.2020
+    @date    18.10.2026
     @brief   This file provides set of functions for StateOS.
 
  ******************************************************************************
@@ -31,6 +31,7 @@
 
 #include "inc/osfastmutex.h"
 #include "inc/oscriticalsection.h"
+#include "inc/ostrace.h"
 
 /* -------------------------------------------------------------------------- */
 static
@@ -64,13 +65,13 @@ mut_t *mut_create( void )
 
 	assert_tsk_context();
 
-	sys_lock();
+	sys_schedLock();
 	{
 		mut = malloc(sizeof(mut_t));
 		if (mut)
 			priv_mut_init(mut, mut);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return mut;
 }
@@ -122,6 +123,9 @@ unsigned priv_mut_take( mut_t *mut )
 	if (mut->owner == 0)
 	{
 		mut->owner = System.cur;
+#if OS_TRACE_SIZE
+		core_trc_put(trcTake, mut, (uintptr_t)System.cur);
+#endif
 		return E_SUCCESS;
 	}
 
@@ -202,6 +206,9 @@ unsigned priv_mut_give( mut_t *mut )
 	if (mut->owner == System.cur)
 	{
 		mut->owner = core_one_wakeup(mut->obj.queue, E_SUCCESS);
+#if OS_TRACE_SIZE
+		core_trc_put(trcGive, mut, (uintptr_t)System.cur);
+#endif
 		return E_SUCCESS;
 	}
 
@@ -2,7 +2,7 @@
 
     @file    StateOS: osflag.c
     @author  Rajmund Szymanski
-    @date    06.06.2020
+    @date    18.10.2026
     @brief   This file provides set of functions for StateOS.
 
  ******************************************************************************
@@ -67,13 +67,13 @@ flg_t *flg_create( unsigned init )
 
 	assert_tsk_context();
 
-	sys_lock();
+	sys_schedLock();
 	{
 		flg = malloc(sizeof(flg_t));
 		if (flg)
 			priv_flg_init(flg, init, flg);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return flg;
 }
@@ -252,6 +252,7 @@ unsigned flg_give( flg_t *flg, unsigned flags )
 			obj = &tsk->hdr.obj;
 		}
 
+		core_sel_notify(flg);
 		flags = flg->flags;
 	}
 	sys_unlock();
@@ -2,7 +2,7 @@
 
     @file    StateOS: osjobqueue.c
     @author  Rajmund Szymanski
-    @date    06.06.2020
+    @date    18.10.2026
     @brief   This file provides set of functions for StateOS.
 
  ******************************************************************************
@@ -32,6 +32,7 @@
 #include "inc/osjobqueue.h"
 #include "inc/ostask.h"
 #include "inc/oscriticalsection.h"
+#include "inc/ostrace.h"
 
 /* -------------------------------------------------------------------------- */
 static
@@ -73,14 +74,14 @@ job_t *job_create( unsigned limit )
 	assert_tsk_context();
 	assert(limit);
 
-	sys_lock();
+	sys_schedLock();
 	{
 		bufsize = limit * sizeof(fun_t *);
 		tmp = malloc(sizeof(struct job_T) + bufsize);
 		if (tmp)
 			priv_job_init(job = &tmp->job, tmp->buf, bufsize, tmp);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return job;
 }
@@ -210,6 +211,9 @@ unsigned priv_job_take( job_t *job, fun_t **fun )
 	if (job->count > 0)
 	{
 		priv_job_getUpdate(job, fun);
+#if OS_TRACE_SIZE
+		core_trc_put(trcTake, job, (uintptr_t)System.cur);
+#endif
 		return E_SUCCESS;
 	}
 
@@ -310,6 +314,9 @@ unsigned priv_job_give( job_t *job, fun_t *fun )
 	if (job->count < job->limit)
 	{
 		priv_job_putUpdate(job, fun);
+#if OS_TRACE_SIZE
+		core_trc_put(trcGive, job, (uintptr_t)System.cur);
+#endif
 		return E_SUCCESS;
 	}
 
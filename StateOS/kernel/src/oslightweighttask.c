@@ -0,0 +1,420 @@
+/******************************************************************************
+
+    @file    StateOS: oslightweighttask.c
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "inc/oslightweighttask.h"
+#include "inc/ostask.h"
+#include "inc/oscriticalsection.h"
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_lwd_init( lwd_t *lwd, void *res )
+/* -------------------------------------------------------------------------- */
+{
+	memset(lwd, 0, sizeof(lwd_t));
+
+	core_obj_init(&lwd->obj, res);
+}
+
+/* -------------------------------------------------------------------------- */
+void lwd_init( lwd_t *lwd )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(lwd);
+
+	sys_lock();
+	{
+		priv_lwd_init(lwd, NULL);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+lwd_t *lwd_create( void )
+/* -------------------------------------------------------------------------- */
+{
+	lwd_t *lwd;
+
+	assert_tsk_context();
+
+	sys_schedLock();
+	{
+		lwd = malloc(sizeof(lwd_t));
+		if (lwd)
+			priv_lwd_init(lwd, lwd);
+	}
+	sys_schedUnlock();
+
+	return lwd;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_lwd_reset( lwd_t *lwd, unsigned event )
+/* -------------------------------------------------------------------------- */
+{
+	lwt_t *lwt;
+
+	while (lwt = lwd->head, lwt)
+	{
+		lwd->head = lwt->next;
+		lwt->next = NULL;
+		lwt->sigset = 0;
+	}
+
+	lwd->tail = NULL;
+
+	core_all_wakeup(lwd->obj.queue, event);
+}
+
+/* -------------------------------------------------------------------------- */
+void lwd_reset( lwd_t *lwd )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(lwd);
+	assert(lwd->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_lwd_reset(lwd, E_STOPPED);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void lwd_destroy( lwd_t *lwd )
+/* -------------------------------------------------------------------------- */
+{
+	lwt_t *lwt;
+
+	assert_tsk_context();
+	assert(lwd);
+	assert(lwd->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+	//	pending lightweight tasks lose the dispatcher being freed; their activations are ignored from now on
+		if (lwd->obj.res)
+			for (lwt = lwd->head; lwt != NULL; lwt = lwt->next)
+				lwt->lwd = NULL;
+
+		priv_lwd_reset(lwd, lwd->obj.res ? E_DELETED : E_STOPPED);
+		core_res_free(&lwd->obj);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_lwd_take( lwd_t *lwd, lwt_t **lwt, unsigned *sigset )
+/* -------------------------------------------------------------------------- */
+{
+	if (lwd->head == NULL)
+		return E_TIMEOUT;
+
+	*lwt = lwd->head;
+	lwd->head = (*lwt)->next;
+	if (lwd->head == NULL)
+		lwd->tail = NULL;
+	else
+	//	another lightweight task is pending, so release the next task waiting for the dispatcher
+		core_one_wakeup(lwd->obj.queue, E_SUCCESS);
+	(*lwt)->next = NULL;
+
+//	activations given from now on are collected and dispatched when the handler is completed
+	*sigset = (*lwt)->sigset;
+	(*lwt)->sigset = 0;
+	(*lwt)->busy = true;
+
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_lwt_activate( lwt_t *lwt )
+/* -------------------------------------------------------------------------- */
+{
+	lwd_t *lwd = lwt->lwd;
+
+	if (lwd->tail == NULL)
+	{
+	//	no lightweight task is pending, so release a task waiting for the dispatcher
+		lwd->head = lwt;
+		lwd->tail = lwt;
+		core_one_wakeup(lwd->obj.queue, E_SUCCESS);
+	}
+	else
+	{
+	//	the next waiting task is released when the preceding lightweight task is taken
+		lwd->tail->next = lwt;
+		lwd->tail = lwt;
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_lwt_dispatch( lwt_t *lwt, unsigned sigset )
+/* -------------------------------------------------------------------------- */
+{
+	lwt->state(sigset);
+
+	sys_lock();
+	{
+		lwt->busy = false;
+		if (lwt->lwd == NULL) // the lightweight task has been destroyed while its handler was being executed
+			core_res_free(&lwt->obj);
+		else
+		if (lwt->sigset)
+			priv_lwt_activate(lwt);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_lwd_wait( lwd_t *lwd, lwt_t **lwt, unsigned *sigset, unsigned event )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *cur = System.cur;
+
+//	the lightweight task may have been dispatched by another task in the meantime
+//	keep waiting with the same timepoint until any lightweight task is pending
+	while (event == E_SUCCESS && priv_lwd_take(lwd, lwt, sigset) != E_SUCCESS)
+		event = core_tsk_waitNext(&lwd->obj.queue, cur->delay);
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned lwd_take( lwd_t *lwd )
+/* -------------------------------------------------------------------------- */
+{
+	lwt_t  * lwt = NULL;
+	unsigned sigset = 0;
+	unsigned event;
+
+	assert_tsk_context();
+	assert(lwd);
+	assert(lwd->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		event = priv_lwd_take(lwd, &lwt, &sigset);
+	}
+	sys_unlock();
+
+	if (event == E_SUCCESS)
+		priv_lwt_dispatch(lwt, sigset);
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned lwd_waitFor( lwd_t *lwd, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	lwt_t  * lwt = NULL;
+	unsigned sigset = 0;
+	unsigned event;
+
+	assert_tsk_context();
+	assert(lwd);
+	assert(lwd->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		event = priv_lwd_take(lwd, &lwt, &sigset);
+		if (event == E_TIMEOUT)
+		{
+			event = core_tsk_waitFor(&lwd->obj.queue, delay);
+			event = priv_lwd_wait(lwd, &lwt, &sigset, event);
+		}
+	}
+	sys_unlock();
+
+	if (event == E_SUCCESS)
+		priv_lwt_dispatch(lwt, sigset);
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned lwd_waitUntil( lwd_t *lwd, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	lwt_t  * lwt = NULL;
+	unsigned sigset = 0;
+	unsigned event;
+
+	assert_tsk_context();
+	assert(lwd);
+	assert(lwd->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		event = priv_lwd_take(lwd, &lwt, &sigset);
+		if (event == E_TIMEOUT)
+		{
+			event = core_tsk_waitUntil(&lwd->obj.queue, time);
+			event = priv_lwd_wait(lwd, &lwt, &sigset, event);
+		}
+	}
+	sys_unlock();
+
+	if (event == E_SUCCESS)
+		priv_lwt_dispatch(lwt, sigset);
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_lwt_init( lwt_t *lwt, lwd_t *lwd, act_t *state, void *res )
+/* -------------------------------------------------------------------------- */
+{
+	memset(lwt, 0, sizeof(lwt_t));
+
+	core_obj_init(&lwt->obj, res);
+
+	lwt->lwd   = lwd;
+	lwt->state = state;
+}
+
+/* -------------------------------------------------------------------------- */
+void lwt_init( lwt_t *lwt, lwd_t *lwd, act_t *state )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(lwt);
+	assert(lwd);
+	assert(state);
+
+	sys_lock();
+	{
+		priv_lwt_init(lwt, lwd, state, NULL);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+lwt_t *lwt_create( lwd_t *lwd, act_t *state )
+/* -------------------------------------------------------------------------- */
+{
+	lwt_t *lwt;
+
+	assert_tsk_context();
+	assert(lwd);
+	assert(state);
+
+	sys_schedLock();
+	{
+		lwt = malloc(sizeof(lwt_t));
+		if (lwt)
+			priv_lwt_init(lwt, lwd, state, lwt);
+	}
+	sys_schedUnlock();
+
+	return lwt;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_lwt_cancel( lwt_t *lwt )
+/* -------------------------------------------------------------------------- */
+{
+	lwd_t *lwd = lwt->lwd;
+	lwt_t *prv = NULL;
+	lwt_t *nxt;
+
+	if (lwd == NULL)
+		return;
+
+	for (nxt = lwd->head; nxt != NULL; prv = nxt, nxt = nxt->next)
+	{
+		if (nxt == lwt)
+		{
+			if (prv == NULL)
+				lwd->head = lwt->next;
+			else
+				prv->next = lwt->next;
+			if (lwd->tail == lwt)
+				lwd->tail = prv;
+			break;
+		}
+	}
+
+	lwt->next = NULL;
+	lwt->sigset = 0;
+}
+
+/* -------------------------------------------------------------------------- */
+void lwt_destroy( lwt_t *lwt )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(lwt);
+	assert(lwt->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_lwt_cancel(lwt);
+		if (lwt->busy && lwt->obj.res)
+		//	the handler is being executed; the resource is freed when the handler is completed
+			lwt->lwd = NULL;
+		else
+			core_res_free(&lwt->obj);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void lwt_give( lwt_t *lwt, unsigned sigset )
+/* -------------------------------------------------------------------------- */
+{
+	assert(lwt);
+	assert(lwt->obj.res!=RELEASED);
+	assert(sigset);
+
+	sys_lock();
+	{
+		if (lwt->lwd != NULL) // activations of a lightweight task without the dispatcher are ignored
+		{
+			if (lwt->sigset == 0 && !lwt->busy)
+				priv_lwt_activate(lwt);
+
+			lwt->sigset |= sigset;
+		}
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
@@ -2,7 +2,7 @@
 
     @file    StateOS: oslist.c
     @author  Rajmund Szymanski
-    @date    06.06.2020
+    @date    18.10.2026
     @brief   This file provides set of functions for StateOS.
 
  ******************************************************************************
@@ -65,13 +65,13 @@ lst_t *lst_create( void )
 
 	assert_tsk_context();
 
-	sys_lock();
+	sys_schedLock();
 	{
 		lst = malloc(sizeof(lst_t));
 		if (lst)
 			priv_lst_init(lst, lst);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return lst;
 }
@@ -124,6 +124,8 @@ unsigned priv_lst_take( lst_t *lst, void **data )
 	{
 		*data = lst->head.next + 1;
 		lst->head.next = lst->head.next->next;
+		if (lst->head.next == NULL)
+			lst->tail = NULL;
 		return E_SUCCESS;
 	}
 
@@ -207,6 +209,7 @@ void lst_give( lst_t *lst, const void *data )
 {
 	tsk_t *tsk;
 	que_t *ptr;
+	que_t *que;
 
 	assert(lst);
 	assert(lst->obj.res!=RELEASED);
@@ -222,9 +225,11 @@ void lst_give( lst_t *lst, const void *data )
 		}
 		else
 		{
-			for (ptr = &lst->head; ptr->next; ptr = ptr->next);
-			ptr->next = (que_t *)data - 1;
-			ptr->next->next = 0;
+			que = (que_t *)data - 1;
+			que->next = NULL;
+			ptr = lst->tail ? lst->tail : &lst->head;
+			ptr->next = que;
+			lst->tail = que;
 		}
 	}
 	sys_unlock();
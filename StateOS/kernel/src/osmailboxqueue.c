@@ -2,7 +2,7 @@
 
     @file    StateOS: osmailboxqueue.c
     @author  Rajmund Szymanski
-    @date    06.06.2020
+    @date    18.10.2026
     @brief   This file provides set of functions for StateOS.
 
  ******************************************************************************
@@ -32,6 +32,7 @@
 #include "inc/osmailboxqueue.h"
 #include "inc/ostask.h"
 #include "inc/oscriticalsection.h"
+#include "inc/ostrace.h"
 
 /* -------------------------------------------------------------------------- */
 static
@@ -76,14 +77,14 @@ box_t *box_create( unsigned limit, unsigned size )
 	assert(limit);
 	assert(size);
 
-	sys_lock();
+	sys_schedLock();
 	{
 		bufsize = limit * size;
 		tmp = malloc(sizeof(struct box_T) + bufsize);
 		if (tmp)
 			priv_box_init(box = &tmp->box, size, tmp->buf, bufsize, tmp);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return box;
 }
@@ -136,13 +137,12 @@ static
 void priv_box_get( box_t *box, char *data )
 /* -------------------------------------------------------------------------- */
 {
-	unsigned i = box->head;
-	unsigned j = 0;
+	unsigned i = box->head + box->size;
 
-	do data[j++] = box->data[i++]; while (j < box->size);
+	memcpy(data, &box->data[box->head], box->size);
 
 	box->head = (i < box->limit) ? i : 0;
-	box->count -= j;
+	box->count -= box->size;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -150,13 +150,12 @@ static
 void priv_box_put( box_t *box, const char *data )
 /* -------------------------------------------------------------------------- */
 {
-	unsigned i = box->tail;
-	unsigned j = 0;
+	unsigned i = box->tail + box->size;
 
-	do box->data[i++] = data[j++]; while (j < box->size);
+	memcpy(&box->data[box->tail], data, box->size);
 
 	box->tail = (i < box->limit) ? i : 0;
-	box->count += j;
+	box->count += box->size;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -191,6 +190,7 @@ void priv_box_putUpdate( box_t *box, const char *data )
 	priv_box_put(box, data);
 	tsk = core_one_wakeup(box->obj.queue, E_SUCCESS);
 	if (tsk) priv_box_get(box, tsk->tmp.box.data.in);
+	else     core_sel_notify(box);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -216,6 +216,9 @@ unsigned priv_box_take( box_t *box, void *data )
 	if (box->count > 0)
 	{
 		priv_box_getUpdate(box, data);
+#if OS_TRACE_SIZE
+		core_trc_put(trcTake, box, (uintptr_t)System.cur);
+#endif
 		return E_SUCCESS;
 	}
 
@@ -307,6 +310,9 @@ unsigned priv_box_give( box_t *box, const void *data )
 	if (box->count < box->limit)
 	{
 		priv_box_putUpdate(box, data);
+#if OS_TRACE_SIZE
+		core_trc_put(trcGive, box, (uintptr_t)System.cur);
+#endif
 		return E_SUCCESS;
 	}
 
@@ -2,7 +2,7 @@
 
     @file    StateOS: osmemorypool.c
     @author  Rajmund Szymanski
-    @date    06.06.2020
+    @date    18.10.2026
     @brief   This file provides set of functions for StateOS.
 
  ******************************************************************************
@@ -38,6 +38,7 @@ void mem_bind( mem_t *mem )
 /* -------------------------------------------------------------------------- */
 {
 	que_t  * ptr;
+	que_t  * que;
 	unsigned cnt;
 
 	assert_tsk_context();
@@ -48,11 +49,13 @@ void mem_bind( mem_t *mem )
 
 	sys_lock();
 	{
-		ptr = mem->data;
+		ptr = &mem->lst.head;
+		que = mem->data;
 		cnt = mem->limit;
 
-		mem->lst.head.next = 0;
-		while (cnt--) { mem_give(mem, ++ptr); ptr += mem->size; }
+		while (cnt--) { ptr->next = que; ptr = que; que += 1 + mem->size; }
+		ptr->next = 0;
+		mem->lst.tail = ptr;
 	}
 	sys_unlock();
 }
@@ -102,14 +105,14 @@ mem_t *mem_create( unsigned limit, size_t size )
 	assert(limit);
 	assert(size);
 
-	sys_lock();
+	sys_schedLock();
 	{
 		bufsize = limit * (1 + MEM_SIZE(size)) * sizeof(que_t);
 		tmp = malloc(sizeof(struct mem_T) + bufsize);
 		if (tmp)
 			priv_mem_init(mem = &tmp->mem, size, tmp->buf, bufsize, tmp);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return mem;
 }
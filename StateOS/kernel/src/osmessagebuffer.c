@@ -2,7 +2,7 @@
 
     @file    StateOS: osmessagebuffer.c
     @author  Rajmund Szymanski
-    @date    06.06.2020
+    @date    18.10.2026
     @brief   This file provides set of functions for StateOS.
 
  ******************************************************************************
@@ -32,6 +32,7 @@
 #include "inc/osmessagebuffer.h"
 #include "inc/ostask.h"
 #include "inc/oscriticalsection.h"
+#include "inc/ostrace.h"
 
 /* -------------------------------------------------------------------------- */
 static
@@ -73,14 +74,14 @@ msg_t *msg_create( size_t limit )
 	assert_tsk_context();
 	assert(limit);
 
-	sys_lock();
+	sys_schedLock();
 	{
 		bufsize = limit;
 		tmp = malloc(sizeof(struct msg_T) + bufsize);
 		if (tmp)
 			priv_msg_init(msg = &tmp->msg, tmp->buf, bufsize, tmp);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return msg;
 }
@@ -134,11 +135,16 @@ void priv_msg_peek( msg_t *msg, char *data, unsigned size )
 /* -------------------------------------------------------------------------- */
 {
 	unsigned i = msg->head;
+	unsigned n = msg->limit - i;
 
-	while (size--)
+	if (size < n)
+	{
+		memcpy(data, &msg->data[i], size);
+	}
+	else
 	{
-		*data++ = msg->data[i++];
-		if (i >= msg->limit) i = 0;
+		memcpy(data, &msg->data[i], n);
+		memcpy(data + n, msg->data, size - n);
 	}
 }
 
@@ -148,14 +154,20 @@ void priv_msg_get( msg_t *msg, char *data, unsigned size )
 /* -------------------------------------------------------------------------- */
 {
 	unsigned i = msg->head;
+	unsigned n = msg->limit - i;
 
 	msg->count -= size;
-	while (size--)
+	if (size < n)
+	{
+		memcpy(data, &msg->data[i], size);
+		msg->head = i + size;
+	}
+	else
 	{
-		*data++ = msg->data[i++];
-		if (i >= msg->limit) i = 0;
+		memcpy(data, &msg->data[i], n);
+		memcpy(data + n, msg->data, size - n);
+		msg->head = size - n;
 	}
-	msg->head = i;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -164,14 +176,20 @@ void priv_msg_put( msg_t *msg, const char *data, unsigned size )
 /* -------------------------------------------------------------------------- */
 {
 	unsigned i = msg->tail;
+	unsigned n = msg->limit - i;
 
 	msg->count += size;
-	while (size--)
+	if (size < n)
 	{
-		msg->data[i++] = *data++;
-		if (i >= msg->limit) i = 0;
+		memcpy(&msg->data[i], data, size);
+		msg->tail = i + size;
+	}
+	else
+	{
+		memcpy(&msg->data[i], data, n);
+		memcpy(msg->data, data + n, size - n);
+		msg->tail = size - n;
 	}
-	msg->tail = i;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -259,6 +277,8 @@ void priv_msg_putUpdate( msg_t *msg, const char *data, unsigned size )
 			core_one_wakeup(msg->obj.queue, E_FAILURE);
 		}
 	}
+
+	core_sel_notify(msg);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -287,7 +307,13 @@ unsigned priv_msg_take( msg_t *msg, char *data, unsigned size )
 	if (msg->count > 0)
 	{
 		if (size >= priv_msg_size(msg))
-			return priv_msg_getUpdate(msg, data, size);
+		{
+			size = priv_msg_getUpdate(msg, data, size);
+#if OS_TRACE_SIZE
+			core_trc_put(trcTake, msg, (uintptr_t)System.cur);
+#endif
+			return size;
+		}
 
 		return E_FAILURE;
 	}
@@ -382,6 +408,9 @@ unsigned priv_msg_give( msg_t *msg, const char *data, unsigned size )
 	if (msg->count + sizeof(unsigned) + size <= msg->limit)
 	{
 		priv_msg_putUpdate(msg, data, size);
+#if OS_TRACE_SIZE
+		core_trc_put(trcGive, msg, (uintptr_t)System.cur);
+#endif
 		return E_SUCCESS;
 	}
 
@@ -2,7 +2,7 @@
 
     @file    StateOS: osmutex.c
     @author  Rajmund Szymanski
-    @date    06.06.2020
+    @date    18.10.2026
     @brief   This file provides set of functions for StateOS.
 
  ******************************************************************************
@@ -32,6 +32,7 @@
 #include "inc/osmutex.h"
 #include "inc/ostask.h"
 #include "inc/oscriticalsection.h"
+#include "inc/ostrace.h"
 
 /* -------------------------------------------------------------------------- */
 static
@@ -71,13 +72,13 @@ mtx_t *mtx_create( unsigned mode, unsigned prio )
 
 	assert_tsk_context();
 
-	sys_lock();
+	sys_schedLock();
 	{
 		mtx = malloc(sizeof(mtx_t));
 		if (mtx)
 			priv_mtx_init(mtx, mode, prio, mtx);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return mtx;
 }
@@ -164,6 +165,9 @@ unsigned priv_mtx_take( mtx_t *mtx )
 		assert(mtx->count == 0);
 
 		core_mtx_link(mtx, System.cur);
+#if OS_TRACE_SIZE
+		core_trc_put(trcTake, mtx, (uintptr_t)System.cur);
+#endif
 
 		if ((mtx->mode & mtxInconsistent))
 		{
@@ -180,6 +184,9 @@ unsigned priv_mtx_take( mtx_t *mtx )
 	if ((mtx->mode & mtxTypeMASK) == mtxRecursive && mtx->count < MTX_LIMIT)
 	{
 		mtx->count++;
+#if OS_TRACE_SIZE
+		core_trc_put(trcTake, mtx, (uintptr_t)System.cur);
+#endif
 		return E_SUCCESS;
 	}
 
@@ -280,12 +287,13 @@ unsigned priv_mtx_give( mtx_t *mtx )
 	if ((mtx->mode & (mtxTypeMASK + mtxRobust)) == mtxNormal || mtx->owner == System.cur)
 	{
 		if (mtx->count > 0)
-		{
 			mtx->count--;
-			return E_SUCCESS;
-		}
+		else
+			core_mtx_transferLock(mtx, E_SUCCESS);
 
-		core_mtx_transferLock(mtx, E_SUCCESS);
+#if OS_TRACE_SIZE
+		core_trc_put(trcGive, mtx, (uintptr_t)System.cur);
+#endif
 		return E_SUCCESS;
 	}
 
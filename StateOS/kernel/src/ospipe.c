@@ -0,0 +1,390 @@
+/******************************************************************************
+
+    @file    StateOS: ospipe.c
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "inc/ospipe.h"
+#include "inc/ostask.h"
+#include "inc/oscriticalsection.h"
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_pip_init( pip_t *pip, void *data, size_t bufsize, void *res )
+/* -------------------------------------------------------------------------- */
+{
+	memset(pip, 0, sizeof(pip_t));
+
+	core_obj_init(&pip->obj, res);
+
+	pip->limit = bufsize;
+	pip->data  = data;
+}
+
+/* -------------------------------------------------------------------------- */
+void pip_init( pip_t *pip, void *data, size_t bufsize )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(pip);
+	assert(data);
+	assert(bufsize);
+	assert(bufsize <= UINT_MAX / 2);
+
+	sys_lock();
+	{
+		priv_pip_init(pip, data, bufsize, NULL);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+pip_t *pip_create( size_t limit )
+/* -------------------------------------------------------------------------- */
+{
+	struct pip_T { pip_t pip; char buf[]; } *tmp;
+	pip_t *pip = NULL;
+	size_t bufsize;
+
+	assert_tsk_context();
+	assert(limit);
+	assert(limit <= UINT_MAX / 2);
+
+	sys_schedLock();
+	{
+		bufsize = limit;
+		tmp = malloc(sizeof(struct pip_T) + bufsize);
+		if (tmp)
+			priv_pip_init(pip = &tmp->pip, tmp->buf, bufsize, tmp);
+	}
+	sys_schedUnlock();
+
+	return pip;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_pip_reset( pip_t *pip, unsigned event )
+/* -------------------------------------------------------------------------- */
+{
+	pip->head = 0;
+	pip->tail = 0;
+
+	core_all_wakeup(pip->obj.queue, event);
+}
+
+/* -------------------------------------------------------------------------- */
+void pip_reset( pip_t *pip )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(pip);
+	assert(pip->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_pip_reset(pip, E_STOPPED);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void pip_destroy( pip_t *pip )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(pip);
+	assert(pip->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_pip_reset(pip, pip->obj.res ? E_DELETED : E_STOPPED);
+		core_res_free(&pip->obj);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+// positions of the head and tail are counted modulo (2 * limit),
+// so the full pipe can be distinguished from the empty one without a shared counter
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_pip_count( pip_t *pip, unsigned head, unsigned tail )
+/* -------------------------------------------------------------------------- */
+{
+	if (tail >= head)
+		return tail - head;
+
+	return tail + 2 * pip->limit - head;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_pip_index( pip_t *pip, unsigned pos )
+/* -------------------------------------------------------------------------- */
+{
+	if (pos < pip->limit)
+		return pos;
+
+	return pos - pip->limit;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_pip_next( pip_t *pip, unsigned pos, unsigned size )
+/* -------------------------------------------------------------------------- */
+{
+	if (size < 2 * pip->limit - pos)
+		return pos + size;
+
+	return pos + size - 2 * pip->limit;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_pip_get( pip_t *pip, char *data, unsigned head, unsigned size )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned i = priv_pip_index(pip, head);
+	unsigned n = pip->limit - i;
+
+	if (size < n)
+	{
+		memcpy(data, &pip->data[i], size);
+	}
+	else
+	{
+		memcpy(data, &pip->data[i], n);
+		memcpy(data + n, pip->data, size - n);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_pip_put( pip_t *pip, const char *data, unsigned tail, unsigned size )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned i = priv_pip_index(pip, tail);
+	unsigned n = pip->limit - i;
+
+	if (size < n)
+	{
+		memcpy(&pip->data[i], data, size);
+	}
+	else
+	{
+		memcpy(&pip->data[i], data, n);
+		memcpy(pip->data, data + n, size - n);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_pip_take( pip_t *pip, char *data, unsigned size )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned head = pip->head;
+	unsigned tail = pip->tail;
+	unsigned count;
+
+	__COMPILER_BARRIER();
+
+	count = priv_pip_count(pip, head, tail);
+	if (count == 0)
+		return E_TIMEOUT;
+
+	if (size > count)
+		size = count;
+	priv_pip_get(pip, data, head, size);
+
+	__COMPILER_BARRIER();
+
+	pip->head = priv_pip_next(pip, head, size);
+
+	return size;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned pip_take( pip_t *pip, void *data, unsigned size )
+/* -------------------------------------------------------------------------- */
+{
+	assert(pip);
+	assert(pip->obj.res!=RELEASED);
+	assert(pip->data);
+	assert(pip->limit);
+	assert(data);
+
+	return priv_pip_take(pip, data, size);
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned pip_waitFor( pip_t *pip, void *data, unsigned size, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned len;
+
+	assert_tsk_context();
+	assert(pip);
+	assert(pip->obj.res!=RELEASED);
+	assert(pip->data);
+	assert(pip->limit);
+	assert(data);
+
+	len = priv_pip_take(pip, data, size);
+
+	if (len == E_TIMEOUT)
+	{
+		sys_lock();
+		{
+			if (pip->head == pip->tail)
+				len = core_tsk_waitFor(&pip->obj.queue, delay);
+			else
+				len = E_SUCCESS;
+		}
+		sys_unlock();
+
+		if (len == E_SUCCESS)
+			len = priv_pip_take(pip, data, size);
+	}
+
+	return len;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned pip_waitUntil( pip_t *pip, void *data, unsigned size, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned len;
+
+	assert_tsk_context();
+	assert(pip);
+	assert(pip->obj.res!=RELEASED);
+	assert(pip->data);
+	assert(pip->limit);
+	assert(data);
+
+	len = priv_pip_take(pip, data, size);
+
+	if (len == E_TIMEOUT)
+	{
+		sys_lock();
+		{
+			if (pip->head == pip->tail)
+				len = core_tsk_waitUntil(&pip->obj.queue, time);
+			else
+				len = E_SUCCESS;
+		}
+		sys_unlock();
+
+		if (len == E_SUCCESS)
+			len = priv_pip_take(pip, data, size);
+	}
+
+	return len;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_pip_give( pip_t *pip, const char *data, unsigned size )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned head = pip->head;
+	unsigned tail = pip->tail;
+
+	__COMPILER_BARRIER();
+
+	if (size > pip->limit)
+		return E_FAILURE;
+
+	if (size > pip->limit - priv_pip_count(pip, head, tail))
+		return E_TIMEOUT;
+
+	priv_pip_put(pip, data, tail, size);
+
+	__COMPILER_BARRIER();
+
+	pip->tail = priv_pip_next(pip, tail, size);
+
+	__COMPILER_BARRIER();
+
+	if (pip->obj.queue != 0)
+	{
+		sys_lock();
+		{
+			core_one_wakeup(pip->obj.queue, E_SUCCESS);
+		}
+		sys_unlock();
+	}
+
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned pip_give( pip_t *pip, const void *data, unsigned size )
+/* -------------------------------------------------------------------------- */
+{
+	assert(pip);
+	assert(pip->obj.res!=RELEASED);
+	assert(pip->data);
+	assert(pip->limit);
+	assert(data);
+
+	return priv_pip_give(pip, data, size);
+}
+
+/* -------------------------------------------------------------------------- */
+size_t pip_count( pip_t *pip )
+/* -------------------------------------------------------------------------- */
+{
+	assert(pip);
+	assert(pip->obj.res!=RELEASED);
+
+	return priv_pip_count(pip, pip->head, pip->tail);
+}
+
+/* -------------------------------------------------------------------------- */
+size_t pip_space( pip_t *pip )
+/* -------------------------------------------------------------------------- */
+{
+	assert(pip);
+	assert(pip->obj.res!=RELEASED);
+
+	return pip->limit - priv_pip_count(pip, pip->head, pip->tail);
+}
+
+/* -------------------------------------------------------------------------- */
+size_t pip_limit( pip_t *pip )
+/* -------------------------------------------------------------------------- */
+{
+	assert(pip);
+	assert(pip->obj.res!=RELEASED);
+
+	return pip->limit;
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,179 @@
+/******************************************************************************
+
+    @file    StateOS: osselect.c
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "inc/osselect.h"
+#include "inc/ostask.h"
+#include "inc/oscriticalsection.h"
+
+/* -------------------------------------------------------------------------- */
+static
+bool priv_sel_ready( const sel_t *sel )
+/* -------------------------------------------------------------------------- */
+{
+	switch (sel->type)
+	{
+	case selSemaphore:     return ((sem_t *)sel->obj)->count > 0;
+	case selStreamBuffer:  return ((stm_t *)sel->obj)->count > 0;
+	case selMessageBuffer: return ((msg_t *)sel->obj)->count > 0;
+	case selMailboxQueue:  return ((box_t *)sel->obj)->count > 0;
+	case selEventQueue:    return ((evq_t *)sel->obj)->count > 0;
+	case selFlag:          return (((flg_t *)sel->obj)->flags & sel->flags) != 0;
+	default:               return false;
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_sel_take( const sel_t *sel, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned i;
+
+	for (i = 0; i < count; i++)
+		if (priv_sel_ready(&sel[i]))
+			return i;
+
+	return E_TIMEOUT;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned sel_take( const sel_t *sel, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event;
+
+	assert(sel);
+	assert(count);
+
+	sys_lock();
+	{
+		event = priv_sel_take(sel, count);
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_sel_wait( const sel_t *sel, unsigned count, unsigned event )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *cur = System.cur;
+
+//	the object that woke up the task may have been taken by another task in the meantime
+//	keep waiting with the same timepoint until any of the supervised objects is ready
+	while (event < count && !priv_sel_ready(&sel[event]))
+	{
+		event = priv_sel_take(sel, count);
+		if (event == E_TIMEOUT)
+			event = core_tsk_waitNext(&System.sel, cur->delay);
+	}
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned sel_waitFor( const sel_t *sel, unsigned count, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event;
+
+	assert_tsk_context();
+	assert(sel);
+	assert(count);
+
+	sys_lock();
+	{
+		event = priv_sel_take(sel, count);
+		if (event == E_TIMEOUT)
+		{
+			System.cur->tmp.sel.list  = sel;
+			System.cur->tmp.sel.count = count;
+			event = core_tsk_waitFor(&System.sel, delay);
+			event = priv_sel_wait(sel, count, event);
+		}
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned sel_waitUntil( const sel_t *sel, unsigned count, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event;
+
+	assert_tsk_context();
+	assert(sel);
+	assert(count);
+
+	sys_lock();
+	{
+		event = priv_sel_take(sel, count);
+		if (event == E_TIMEOUT)
+		{
+			System.cur->tmp.sel.list  = sel;
+			System.cur->tmp.sel.count = count;
+			event = core_tsk_waitUntil(&System.sel, time);
+			event = priv_sel_wait(sel, count, event);
+		}
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+void core_sel_wakeup( void *obj )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t    *tsk;
+	tsk_t    *nxt;
+	unsigned  i;
+
+	for (tsk = System.sel; tsk; tsk = nxt)
+	{
+		nxt = tsk->hdr.obj.queue;
+		for (i = 0; i < tsk->tmp.sel.count; i++)
+		{
+			if (tsk->tmp.sel.list[i].obj == obj)
+			{
+				if (priv_sel_ready(&tsk->tmp.sel.list[i]))
+					core_tsk_wakeup(tsk, i);
+				break;
+			}
+		}
+	}
+}
+
+/* -------------------------------------------------------------------------- */
@@ -2,7 +2,7 @@
 
     @file    StateOS: ossemaphore.c
     @author  Rajmund Szymanski
-    @date    06.06.2020
+    @date    18.10.2026
     @brief   This file provides set of functions for StateOS.
 
  ******************************************************************************
@@ -31,6 +31,7 @@
 
 #include "inc/ossemaphore.h"
 #include "inc/oscriticalsection.h"
+#include "inc/ostrace.h"
 
 /* -------------------------------------------------------------------------- */
 static
@@ -68,13 +69,13 @@ sem_t *sem_create( unsigned init, unsigned limit )
 
 	assert_tsk_context();
 
-	sys_lock();
+	sys_schedLock();
 	{
 		sem = malloc(sizeof(sem_t));
 		if (sem)
 			priv_sem_init(sem, init, limit, sem);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return sem;
 }
@@ -129,6 +130,9 @@ unsigned priv_sem_take( sem_t *sem )
 		return E_TIMEOUT;
 
 	sem->count--;
+#if OS_TRACE_SIZE
+	core_trc_put(trcTake, sem, (uintptr_t)System.cur);
+#endif
 	return E_SUCCESS;
 }
 
@@ -202,13 +206,18 @@ static
 unsigned priv_sem_give( sem_t *sem )
 /* -------------------------------------------------------------------------- */
 {
-	if (core_one_wakeup(sem->obj.queue, E_SUCCESS) != 0)
-		return E_SUCCESS;
+	if (core_one_wakeup(sem->obj.queue, E_SUCCESS) == 0)
+	{
+		if (sem->count >= sem->limit)
+			return E_TIMEOUT;
 
-	if (sem->count >= sem->limit)
-		return E_TIMEOUT;
+		sem->count++;
+		core_sel_notify(sem);
+	}
 
-	sem->count++;
+#if OS_TRACE_SIZE
+	core_trc_put(trcGive, sem, (uintptr_t)System.cur);
+#endif
 	return E_SUCCESS;
 }
 
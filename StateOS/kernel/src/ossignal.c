@@ -2,7 +2,7 @@
 
     @file    StateOS: ossignal.c
     @author  Rajmund Szymanski
-    @date    06.06.2020
+    @date    18.10.2026
     @brief   This file provides set of functions for StateOS.
 
  ******************************************************************************
@@ -67,13 +67,13 @@ sig_t *sig_create( unsigned mask )
 
 	assert_tsk_context();
 
-	sys_lock();
+	sys_schedLock();
 	{
 		sig = malloc(sizeof(sig_t));
 		if (sig)
 			priv_sig_init(sig, mask, sig);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return sig;
 }
@@ -2,7 +2,7 @@
 
     @file    StateOS: osstreambuffer.c
     @author  Rajmund Szymanski
-    @date    06.06.2020
+    @date    18.10.2026
     @brief   This file provides set of functions for StateOS.
 
  ******************************************************************************
@@ -32,6 +32,7 @@
 #include "inc/osstreambuffer.h"
 #include "inc/ostask.h"
 #include "inc/oscriticalsection.h"
+#include "inc/ostrace.h"
 
 /* -------------------------------------------------------------------------- */
 static
@@ -73,14 +74,14 @@ stm_t *stm_create( size_t limit )
 	assert_tsk_context();
 	assert(limit);
 
-	sys_lock();
+	sys_schedLock();
 	{
 		bufsize = limit;
 		tmp = malloc(sizeof(struct stm_T) + bufsize);
 		if (tmp)
 			priv_stm_init(stm = &tmp->stm, tmp->buf, bufsize, tmp);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return stm;
 }
@@ -134,14 +135,20 @@ void priv_stm_get( stm_t *stm, char *data, unsigned size )
 /* -------------------------------------------------------------------------- */
 {
 	unsigned i = stm->head;
+	unsigned n = stm->limit - i;
 
 	stm->count -= size;
-	while (size--)
+	if (size < n)
+	{
+		memcpy(data, &stm->data[i], size);
+		stm->head = i + size;
+	}
+	else
 	{
-		*data++ = stm->data[i++];
-		if (i >= stm->limit) i = 0;
+		memcpy(data, &stm->data[i], n);
+		memcpy(data + n, stm->data, size - n);
+		stm->head = size - n;
 	}
-	stm->head = i;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -150,14 +157,20 @@ void priv_stm_put( stm_t *stm, const char *data, unsigned size )
 /* -------------------------------------------------------------------------- */
 {
 	unsigned i = stm->tail;
+	unsigned n = stm->limit - i;
 
 	stm->count += size;
-	while (size--)
+	if (size < n)
+	{
+		memcpy(&stm->data[i], data, size);
+		stm->tail = i + size;
+	}
+	else
 	{
-		stm->data[i++] = *data++;
-		if (i >= stm->limit) i = 0;
+		memcpy(&stm->data[i], data, n);
+		memcpy(stm->data, data + n, size - n);
+		stm->tail = size - n;
 	}
-	stm->tail = i;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -172,28 +185,22 @@ void priv_stm_skip( stm_t *stm, unsigned size )
 
 /* -------------------------------------------------------------------------- */
 static
-unsigned priv_stm_getUpdate( stm_t *stm, char *data, unsigned size )
+void priv_stm_putWaiting( stm_t *stm )
 /* -------------------------------------------------------------------------- */
 {
-	if (size > stm->count)
-		size = stm->count;
-	priv_stm_get(stm, data, size);
-
 	while (stm->obj.queue != 0 && stm->count + stm->obj.queue->tmp.stm.size <= stm->limit)
 	{
 		priv_stm_put(stm, stm->obj.queue->tmp.stm.data.out, stm->obj.queue->tmp.stm.size);
 		core_one_wakeup(stm->obj.queue, E_SUCCESS);
 	}
-
-	return size;
 }
 
 /* -------------------------------------------------------------------------- */
 static
-void priv_stm_putUpdate( stm_t *stm, const char *data, unsigned size )
+void priv_stm_getWaiting( stm_t *stm )
 /* -------------------------------------------------------------------------- */
 {
-	priv_stm_put(stm, data, size);
+	unsigned size;
 
 	while (stm->obj.queue != 0 && stm->count > 0)
 	{
@@ -205,6 +212,29 @@ void priv_stm_putUpdate( stm_t *stm, const char *data, unsigned size )
 	}
 }
 
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_stm_getUpdate( stm_t *stm, char *data, unsigned size )
+/* -------------------------------------------------------------------------- */
+{
+	if (size > stm->count)
+		size = stm->count;
+	priv_stm_get(stm, data, size);
+	priv_stm_putWaiting(stm);
+
+	return size;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_stm_putUpdate( stm_t *stm, const char *data, unsigned size )
+/* -------------------------------------------------------------------------- */
+{
+	priv_stm_put(stm, data, size);
+	priv_stm_getWaiting(stm);
+	core_sel_notify(stm);
+}
+
 /* -------------------------------------------------------------------------- */
 static
 void priv_stm_skipUpdate( stm_t *stm, unsigned size )
@@ -228,7 +258,13 @@ unsigned priv_stm_take( stm_t *stm, char *data, unsigned size )
 /* -------------------------------------------------------------------------- */
 {
 	if (stm->count > 0)
-		return priv_stm_getUpdate(stm, data, size);
+	{
+		size = priv_stm_getUpdate(stm, data, size);
+#if OS_TRACE_SIZE
+		core_trc_put(trcTake, stm, (uintptr_t)System.cur);
+#endif
+		return size;
+	}
 
 	return E_TIMEOUT;
 }
@@ -320,6 +356,9 @@ unsigned priv_stm_give( stm_t *stm, const char *data, unsigned size )
 	if (stm->count + size <= stm->limit)
 	{
 		priv_stm_putUpdate(stm, data, size);
+#if OS_TRACE_SIZE
+		core_trc_put(trcGive, stm, (uintptr_t)System.cur);
+#endif
 		return E_SUCCESS;
 	}
 
@@ -445,6 +484,181 @@ unsigned stm_push( stm_t *stm, const void *data, unsigned size )
 	return event;
 }
 
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_stm_space( stm_t *stm )
+/* -------------------------------------------------------------------------- */
+{
+	if (stm->tail < stm->head || stm->count == stm->limit)
+		return stm->head - stm->tail;
+
+	return stm->limit - stm->tail;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_stm_reserve( stm_t *stm, void **data, unsigned size )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned space;
+
+	if (stm->count == 0)
+	{
+		stm->head = 0;
+		stm->tail = 0;
+	}
+	else
+	if (stm->obj.queue != 0)
+	{
+		return E_TIMEOUT;
+	}
+
+	space = priv_stm_space(stm);
+	if (space == 0)
+		return E_TIMEOUT;
+
+	if (size > space)
+		size = space;
+	*data = &stm->data[stm->tail];
+
+	return size;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned stm_reserve( stm_t *stm, void **data, unsigned size )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned len;
+
+	assert(stm);
+	assert(stm->obj.res!=RELEASED);
+	assert(stm->data);
+	assert(stm->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		len = priv_stm_reserve(stm, data, size);
+	}
+	sys_unlock();
+
+	return len;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_stm_commit( stm_t *stm, unsigned size )
+/* -------------------------------------------------------------------------- */
+{
+	if (size <= priv_stm_space(stm))
+	{
+		stm->count += size;
+		stm->tail  += size;
+		if (stm->tail >= stm->limit) stm->tail -= stm->limit;
+		priv_stm_getWaiting(stm);
+		core_sel_notify(stm);
+
+		return E_SUCCESS;
+	}
+
+	return E_FAILURE;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned stm_commit( stm_t *stm, unsigned size )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event;
+
+	assert(stm);
+	assert(stm->obj.res!=RELEASED);
+	assert(stm->data);
+	assert(stm->limit);
+
+	sys_lock();
+	{
+		event = priv_stm_commit(stm, size);
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_stm_peek( stm_t *stm, void **data )
+/* -------------------------------------------------------------------------- */
+{
+	if (stm->count > 0)
+	{
+		*data = &stm->data[stm->head];
+
+		if (stm->head < stm->tail)
+			return stm->tail - stm->head;
+
+		return stm->limit - stm->head;
+	}
+
+	return E_TIMEOUT;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned stm_peek( stm_t *stm, void **data )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned len;
+
+	assert(stm);
+	assert(stm->obj.res!=RELEASED);
+	assert(stm->data);
+	assert(stm->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		len = priv_stm_peek(stm, data);
+	}
+	sys_unlock();
+
+	return len;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_stm_consume( stm_t *stm, unsigned size )
+/* -------------------------------------------------------------------------- */
+{
+	if (size <= stm->count)
+	{
+		priv_stm_skip(stm, size);
+		priv_stm_putWaiting(stm);
+
+		return E_SUCCESS;
+	}
+
+	return E_FAILURE;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned stm_consume( stm_t *stm, unsigned size )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event;
+
+	assert(stm);
+	assert(stm->obj.res!=RELEASED);
+	assert(stm->data);
+	assert(stm->limit);
+
+	sys_lock();
+	{
+		event = priv_stm_consume(stm, size);
+	}
+	sys_unlock();
+
+	return event;
+}
+
 /* -------------------------------------------------------------------------- */
 size_t stm_count( stm_t *stm )
 /* -------------------------------------------------------------------------- */
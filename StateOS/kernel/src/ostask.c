@@ -2,7 +2,7 @@
 
     @file    StateOS: ostask.c
     @author  Rajmund Szymanski
-    @date    09.06.2020
+    @date    18.10.2026
     @brief   This file provides set of functions for StateOS.
 
  ******************************************************************************
@@ -113,16 +113,14 @@ tsk_t *wrk_create( unsigned prio, fun_t *state, size_t size )
 	assert(state);
 	assert(size>sizeof(ctx_t));
 
-	sys_lock();
+	sys_schedLock();
 	{
 		tsk = priv_wrk_create(prio, state, size, false);
-		if (tsk)
-		{
-			core_ctx_init(tsk);
-			core_tsk_insert(tsk);
-		}
 	}
-	sys_unlock();
+	sys_schedUnlock();
+
+	if (tsk)
+		tsk_start(tsk);
 
 	return tsk;
 }
@@ -137,16 +135,14 @@ tsk_t *wrk_detached( unsigned prio, fun_t *state, size_t size )
 	assert(state);
 	assert(size>sizeof(ctx_t));
 
-	sys_lock();
+	sys_schedLock();
 	{
 		tsk = priv_wrk_create(prio, state, size, true);
-		if (tsk)
-		{
-			core_ctx_init(tsk);
-			core_tsk_insert(tsk);
-		}
 	}
-	sys_unlock();
+	sys_schedUnlock();
+
+	if (tsk)
+		tsk_start(tsk);
 
 	return tsk;
 }
@@ -162,11 +158,11 @@ tsk_t *thd_create( unsigned prio, fun_t *state, size_t size, bool detached )
 	assert(state);
 	assert(size>sizeof(ctx_t));
 
-	sys_lock();
+	sys_schedLock();
 	{
 		tsk = priv_wrk_create(prio, state, size, detached);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return tsk;
 }
@@ -502,6 +498,61 @@ unsigned tsk_getPrio( void )
 	return prio;
 }
 
+/* -------------------------------------------------------------------------- */
+uint64_t tsk_getRunTime( tsk_t *tsk )
+/* -------------------------------------------------------------------------- */
+{
+#if OS_TASK_STATS
+	uint64_t time;
+
+	assert(tsk);
+
+	sys_lock();
+	{
+		core_tsk_time();
+		time = tsk->time;
+	}
+	sys_unlock();
+
+	return time;
+#else
+	(void) tsk;
+
+	return 0;
+#endif
+}
+
+#if OS_TASK_STATS
+static struct { uint64_t time, idle; } Load; // run times at the previous call of sys_getLoad
+#endif
+
+/* -------------------------------------------------------------------------- */
+unsigned sys_getLoad( void )
+/* -------------------------------------------------------------------------- */
+{
+#if OS_TASK_STATS
+	uint64_t time;
+	uint64_t idle;
+
+	sys_lock();
+	{
+		core_tsk_time();
+		time = System.time - Load.time;
+		idle = IDLE.time   - Load.idle;
+		Load.time = System.time;
+		Load.idle = IDLE.time;
+	}
+	sys_unlock();
+
+	if (time == 0)
+		return 0;
+
+	return (unsigned)((time - idle) * 100 / time);
+#else
+	return 0;
+#endif
+}
+
 /* -------------------------------------------------------------------------- */
 void tsk_sleepFor( cnt_t delay )
 /* -------------------------------------------------------------------------- */
@@ -598,6 +649,9 @@ void priv_sig_handler( tsk_t *tsk )
 		sigset &= -sigset;
 		tsk->sig.sigset &= ~sigset;
 
+#if OS_LOCK_TRACE
+		void *cri = core_cri_suspend();
+#endif
 		port_clr_lock();
 		{
 			if (action)
@@ -607,6 +661,9 @@ void priv_sig_handler( tsk_t *tsk )
 			}
 		}
 		port_set_lock();
+#if OS_LOCK_TRACE
+		core_cri_resume(cri);
+#endif
 	}
 }
 
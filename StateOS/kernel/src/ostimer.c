@@ -2,7 +2,7 @@
 
     @file    StateOS: ostimer.c
     @author  Rajmund Szymanski
-    @date    06.06.2020
+    @date    18.10.2026
     @brief   This file provides set of functions for StateOS.
 
  ******************************************************************************
@@ -66,13 +66,13 @@ tmr_t *tmr_create( fun_t *state )
 
 	assert_tsk_context();
 
-	sys_lock();
+	sys_schedLock();
 	{
 		tmr = malloc(sizeof(tmr_t));
 		if (tmr)
 			priv_tmr_init(tmr, state, tmr);
 	}
-	sys_unlock();
+	sys_schedUnlock();
 
 	return tmr;
 }
@@ -143,6 +143,7 @@ void tmr_start( tmr_t *tmr, cnt_t delay, cnt_t period )
 		tmr->start  = core_sys_time();
 		tmr->delay  = delay;
 		tmr->period = period;
+		tmr->slack  = 0;
 
 		priv_tmr_start(tmr);
 	}
@@ -163,6 +164,27 @@ void tmr_startFrom( tmr_t *tmr, cnt_t delay, cnt_t period, fun_t *proc )
 		tmr->start  = core_sys_time();
 		tmr->delay  = delay;
 		tmr->period = period;
+		tmr->slack  = 0;
+
+		priv_tmr_start(tmr);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void tmr_startSlack( tmr_t *tmr, cnt_t delay, cnt_t period, cnt_t slack )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(tmr);
+	assert(tmr->hdr.obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		tmr->start  = core_sys_time();
+		tmr->delay  = delay;
+		tmr->period = period;
+		tmr->slack  = slack;
 
 		priv_tmr_start(tmr);
 	}
@@ -201,6 +223,7 @@ void tmr_startUntil( tmr_t *tmr, cnt_t time )
 		if (tmr->delay > CNT_LIMIT)
 			tmr->delay = 0;
 		tmr->period = 0;
+		tmr->slack  = 0;
 
 		priv_tmr_start(tmr);
 	}
@@ -0,0 +1,108 @@
+/******************************************************************************
+
+    @file    StateOS: ostrace.c
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "inc/ostrace.h"
+#include "inc/oscriticalsection.h"
+
+#if OS_TRACE_SIZE
+
+/* -------------------------------------------------------------------------- */
+
+static trc_t     TRC[OS_TRACE_SIZE]; // ring buffer of the trace records
+static uint32_t  TRC_PUT;            // number of the records put into the buffer
+static uint32_t  TRC_GET;            // number of the records taken from the buffer
+
+/* -------------------------------------------------------------------------- */
+void core_trc_put( unsigned type, const void *obj, uintptr_t arg )
+/* -------------------------------------------------------------------------- */
+{
+	trc_t *trc = &TRC[TRC_PUT++ % (OS_TRACE_SIZE)];
+
+	trc->time = core_cyc_time();
+	trc->type = type;
+	trc->obj  = obj;
+	trc->arg  = arg;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned sys_traceRead( trc_t *table, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	uint32_t lost;
+	unsigned cnt = 0;
+
+	assert(table || count == 0);
+
+	sys_lock();
+	{
+		lost = TRC_PUT - TRC_GET;
+		if (lost > (OS_TRACE_SIZE) && count > 0)
+		{
+			lost -= OS_TRACE_SIZE;
+			TRC_GET += lost;
+			table[cnt].time = core_cyc_time();
+			table[cnt].type = trcLost;
+			table[cnt].obj  = NULL;
+			table[cnt].arg  = lost;
+			cnt++;
+		}
+
+		while (TRC_GET != TRC_PUT && cnt < count)
+			table[cnt++] = TRC[TRC_GET++ % (OS_TRACE_SIZE)];
+	}
+	sys_unlock();
+
+	return cnt;
+}
+
+/* -------------------------------------------------------------------------- */
+void sys_traceDump( void )
+/* -------------------------------------------------------------------------- */
+{
+	static const trh_t trh = { TRC_MAGIC, TRC_VERSION, sizeof(trc_t), sizeof(void *), CYC_FREQUENCY };
+	trc_t    table[16];
+	unsigned rest = (OS_TRACE_SIZE) + 1; // records put during the dump are left for the next one
+	unsigned cnt;
+
+	assert_tsk_context();
+
+	port_trc_write(&trh, sizeof(trh));
+
+	while (cnt = sys_traceRead(table, rest < 16 ? rest : 16), cnt > 0)
+	{
+		port_trc_write(table, cnt * sizeof(trc_t));
+		rest -= cnt;
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_TRACE_SIZE
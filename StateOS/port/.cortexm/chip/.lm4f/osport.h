@@ -2,7 +2,7 @@
 
     @file    StateOS: osport.h
     @author  Rajmund Szymanski
-    @date    29.03.2020
+    @date    18.10.2026
     @brief   StateOS port definitions for LM4F uC.
 
  ******************************************************************************
@@ -39,6 +39,9 @@
 #include "osconfig.h"
 #endif
 #include "osdefs.h"
+#include "osdwt.h"
+#include "ossystick.h"
+#include "osdump.h"
 
 #ifdef __cplusplus
 extern "C" {
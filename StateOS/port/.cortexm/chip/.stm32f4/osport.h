@@ -2,7 +2,7 @@
 
     @file    StateOS: osport.h
     @author  Rajmund Szymanski
-    @date    03.06.2020
+    @date    18.10.2026
     @brief   StateOS port definitions for STM32F4 uC.
 
  ******************************************************************************
@@ -38,6 +38,9 @@
 #endif
 #include "osdefs.h"
 #include "osmpu.h"
+#include "osdwt.h"
+#include "ossystick.h"
+#include "osdump.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -2,7 +2,7 @@
 
     @file    StateOS: osport.c
     @author  Rajmund Szymanski
-    @date    30.05.2020
+    @date    18.10.2026
     @brief   StateOS port file for STM32F7 uC.
 
  ******************************************************************************
@@ -141,6 +141,14 @@ void port_sys_init( void )
 
 	NVIC_SetPriority(PendSV_IRQn, 0xFF);
 
+/******************************************************************************
+ Configuration of cycle counter
+*******************************************************************************/
+
+#if __DWT_USED == 1
+	port_cyc_init();
+#endif
+
 /******************************************************************************
  Configuration of memory protection unit
 *******************************************************************************/
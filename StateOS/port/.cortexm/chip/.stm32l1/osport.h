@@ -2,7 +2,7 @@
 
     @file    StateOS: osport.h
     @author  Rajmund Szymanski
-    @date    29.03.2020
+    @date    18.10.2026
     @brief   StateOS port definitions for STM32L1 uC.
 
  ******************************************************************************
@@ -37,6 +37,9 @@
 #include "osconfig.h"
 #endif
 #include "osdefs.h"
+#include "osdwt.h"
+#include "ossystick.h"
+#include "osdump.h"
 
 #ifdef __cplusplus
 extern "C" {
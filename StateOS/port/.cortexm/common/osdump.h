@@ -0,0 +1,133 @@
+/******************************************************************************
+
+    @file    StateOS: osdump.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file defines the trace dump functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOSDUMP_H
+#define __STATEOSDUMP_H
+
+#include "osport.h"
+
+#if OS_TRACE_SIZE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------- */
+// the trace dump is sent through the ITM stimulus port OS_TRACE_ITM (if defined)
+// otherwise it is appended to the file OS_TRACE_FILE on the host through the semihosting
+
+#ifndef OS_TRACE_FILE
+#define OS_TRACE_FILE "trace.bin"
+#endif
+
+#if defined(ITM) && defined(OS_TRACE_ITM)
+
+/* -------------------------------------------------------------------------- */
+// send the trace dump through the ITM stimulus port; the dump is dropped if the port is disabled
+
+__STATIC_INLINE
+void port_trc_write( const void *data, size_t size )
+{
+	const uint8_t *ptr = (const uint8_t *) data;
+
+	if ((ITM->TCR & ITM_TCR_ITMENA_Msk) == 0 || (ITM->TER & (1UL << (OS_TRACE_ITM))) == 0)
+		return;
+
+	while (size--)
+	{
+		while (ITM->PORT[OS_TRACE_ITM].u32 == 0) __NOP();
+		ITM->PORT[OS_TRACE_ITM].u8 = *ptr++;
+	}
+}
+
+#else
+
+/* -------------------------------------------------------------------------- */
+// semihosting call; the debugger must be connected, otherwise the hard fault occurs
+
+__STATIC_INLINE
+int port_smh_call( int op, const void *arg )
+{
+#if defined(__CC_ARM)
+	return __semihost(op, arg);
+#else
+	int res;
+	__ASM volatile
+	(
+"	mov   r0, %[op]                \n"
+"	mov   r1, %[arg]               \n"
+"	bkpt  0xAB                     \n"
+"	mov   %[res], r0               \n"
+	:	[res] "=r" (res)
+	:	[op]  "r"  (op),
+		[arg] "r"  (arg)
+	:	"r0", "r1", "memory"
+	);
+	return res;
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+// append the trace dump to the file on the host
+
+__STATIC_INLINE
+void port_trc_write( const void *data, size_t size )
+{
+	uintptr_t arg[3];
+	int fd;
+
+	arg[0] = (uintptr_t) OS_TRACE_FILE;
+	arg[1] = 9; // "ab"
+	arg[2] = sizeof(OS_TRACE_FILE) - 1;
+	fd = port_smh_call(0x01, arg); // SYS_OPEN
+	if (fd == -1)
+		return;
+
+	arg[0] = (uintptr_t) fd;
+	arg[1] = (uintptr_t) data;
+	arg[2] = size;
+	port_smh_call(0x05, arg);      // SYS_WRITE
+
+	arg[0] = (uintptr_t) fd;
+	port_smh_call(0x02, arg);      // SYS_CLOSE
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//OS_TRACE_SIZE
+
+#endif//__STATEOSDUMP_H
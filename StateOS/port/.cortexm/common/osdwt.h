@@ -0,0 +1,85 @@
+/******************************************************************************
+
+    @file    StateOS: osdwt.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file defines the cycle counter (DWT) functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOSDWT_H
+#define __STATEOSDWT_H
+
+#include "osport.h"
+
+#if defined (DWT) && defined (CoreDebug)
+
+#ifndef __DWT_USED
+#define __DWT_USED        1
+#else
+#error  __DWT_USED is an internal os definition!
+#endif//__DWT_USED
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------- */
+// cycle counter; it counts cpu clock cycles
+
+#ifdef  CYC_FREQUENCY
+#error  CYC_FREQUENCY is an internal port definition!
+#else
+#define CYC_FREQUENCY (CPU_FREQUENCY)
+#endif
+
+/* -------------------------------------------------------------------------- */
+// enable the cycle counter
+
+__STATIC_INLINE
+void port_cyc_init( void )
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/* -------------------------------------------------------------------------- */
+// return current value of the cycle counter
+
+__STATIC_INLINE
+uint32_t port_cyc_time( void )
+{
+	return DWT->CYCCNT;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//DWT && CoreDebug
+#endif//__STATEOSDWT_H
@@ -0,0 +1,120 @@
+/******************************************************************************
+
+    @file    StateOS: ossystick.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file defines the system timer (SysTick) functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOSSYSTICK_H
+#define __STATEOSSYSTICK_H
+
+#include "osport.h"
+
+#if OS_TICKLESS_IDLE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------- */
+// suppress system timer interrupts for at most 'delay' ticks and wait for any interrupt
+// return number of the ticks elapsed without system timer interrupts
+// it is used only in the non-tick-less mode, when SysTick generates interrupts with frequency OS_FREQUENCY
+
+__STATIC_INLINE
+uint32_t port_sys_sleep( uint32_t delay )
+{
+	uint32_t tick   = SysTick->LOAD + 1;
+	uint32_t limit  = SysTick_LOAD_RELOAD_Msk / tick - 1;
+	uint32_t mask   = __get_PRIMASK();
+	uint32_t ctrl;
+	uint32_t value;
+	uint32_t ahead;
+
+	if (delay > limit)
+		delay = limit;
+
+//	WFI wakes up on any pending interrupt, even if it is masked by PRIMASK
+	__disable_irq();
+
+	ctrl  = SysTick->CTRL;
+	SysTick->CTRL = ctrl & ~SysTick_CTRL_ENABLE_Msk;
+	value = SysTick->VAL;
+
+	if (value == 0 || (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk))
+	{
+	//	system timer interrupt is pending
+		SysTick->CTRL = ctrl | SysTick_CTRL_ENABLE_Msk;
+		__set_PRIMASK(mask);
+		return 0;
+	}
+
+//	the next system timer interrupt occurs 'delay' ticks later than expected
+	SysTick->LOAD = value + delay * tick - 1;
+	SysTick->VAL  = 0;
+	SysTick->CTRL = ctrl | SysTick_CTRL_ENABLE_Msk;
+
+	__DSB();
+	__WFI();
+	__ISB();
+
+	ctrl  = SysTick->CTRL;
+	SysTick->CTRL = ctrl & ~SysTick_CTRL_ENABLE_Msk;
+
+	if (ctrl & SysTick_CTRL_COUNTFLAG_Msk)
+	{
+	//	the sleep is over, system timer interrupt is pending; continue the current tick
+		value = SysTick->LOAD - SysTick->VAL;
+		value = value < tick ? tick - value : 1;
+	}
+	else
+	{
+	//	woken up before the end of the sleep; restore the tick phase
+		value = SysTick->VAL + 1;
+		ahead = (value + tick - 1) / tick;
+		value = value - (ahead - 1) * tick;
+		delay = delay + 1 - ahead;
+	}
+
+	SysTick->LOAD = value - 1;
+	SysTick->VAL  = 0;
+	SysTick->CTRL = ctrl | SysTick_CTRL_ENABLE_Msk;
+	SysTick->LOAD = tick - 1;
+
+	__set_PRIMASK(mask);
+
+	return delay;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//OS_TICKLESS_IDLE
+#endif//__STATEOSSYSTICK_H
@@ -0,0 +1,315 @@
+/******************************************************************************
+
+    @file    StateOS: osport.c
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   StateOS port file for Linux host.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "oskernel.h"
+#include "inc/ostask.h"
+#include <fcntl.h>
+
+/* -------------------------------------------------------------------------- */
+
+void PendSV_Handler( int signo );
+
+static timer_t SysTick;
+#if HW_TIMER_SIZE && OS_ROBIN
+static timer_t RoundRobin;
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tmr_set( timer_t tmr, cnt_t value, cnt_t interval )
+{
+	struct itimerspec its;
+
+	its.it_value.tv_sec     = value / (OS_FREQUENCY);
+	its.it_value.tv_nsec    = (long)((uint64_t)(value % (OS_FREQUENCY)) * 1000000000 / (OS_FREQUENCY));
+	its.it_interval.tv_sec  = interval / (OS_FREQUENCY);
+	its.it_interval.tv_nsec = (long)((uint64_t)(interval % (OS_FREQUENCY)) * 1000000000 / (OS_FREQUENCY));
+
+	timer_settime(tmr, 0, &its, NULL);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tmr_create( timer_t *tmr, int signo )
+{
+	struct sigevent sev = { 0 };
+
+	sev.sigev_notify = SIGEV_SIGNAL;
+	sev.sigev_signo  = signo;
+
+	timer_create(CLOCK_MONOTONIC, &sev, tmr);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_irq_enable( int signo, void (*handler)( int ) )
+{
+	struct sigaction sa = { 0 };
+
+	sa.sa_handler = handler;
+	sa.sa_flags   = SA_RESTART;
+	sigemptyset(&sa.sa_mask);
+	port_sig_fill(&sa.sa_mask); // interrupts of the same priority do not preempt each other
+
+	sigaction(signo, &sa, NULL);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#if HW_TIMER_SIZE == 0
+
+static
+void SysTick_Handler( int signo )
+{
+	(void) signo;
+
+	port_isr_nest++;
+	core_sys_tick();
+	port_isr_nest--;
+}
+
+#else //HW_TIMER_SIZE
+
+static
+void SysTick_Handler( int signo )
+{
+	(void) signo;
+
+	port_isr_nest++;
+	core_tmr_handler();
+	port_isr_nest--;
+}
+
+	#if OS_ROBIN
+
+static
+void RoundRobin_Handler( int signo )
+{
+	(void) signo;
+
+	port_isr_nest++;
+	core_ctx_switch();
+	port_isr_nest--;
+}
+
+	#endif//OS_ROBIN
+
+#endif//HW_TIMER_SIZE
+
+/* -------------------------------------------------------------------------- */
+
+void port_sys_init( void )
+{
+	struct sigaction sa;
+
+/******************************************************************************
+ Make sure that the system timer has not yet been initialized
+ This is only needed for compilers supporting the "constructor" function attribute or its equivalent
+*******************************************************************************/
+
+	sigaction(PendSV_IRQn, NULL, &sa);
+	if (sa.sa_handler == PendSV_Handler) return;
+
+/******************************************************************************
+ End of check
+*******************************************************************************/
+
+/******************************************************************************
+ Configuration of interrupt for context switch
+*******************************************************************************/
+
+	priv_irq_enable(PendSV_IRQn, PendSV_Handler);
+
+/******************************************************************************
+ Configuration of system timer
+*******************************************************************************/
+
+	priv_irq_enable(SysTick_IRQn, SysTick_Handler);
+	priv_tmr_create(&SysTick, SysTick_IRQn);
+
+#if HW_TIMER_SIZE == 0
+
+/******************************************************************************
+ Non-tick-less mode: system timer must generate interrupts with frequency OS_FREQUENCY
+*******************************************************************************/
+
+	priv_tmr_set(SysTick, 1, 1);
+
+#else //HW_TIMER_SIZE
+
+	#if OS_ROBIN
+
+/******************************************************************************
+ Tick-less mode with preemption: configuration of timer for context switch triggering
+ It must generate interrupts with frequency OS_ROBIN
+*******************************************************************************/
+
+	priv_irq_enable(RoundRobin_IRQn, RoundRobin_Handler);
+	priv_tmr_create(&RoundRobin, RoundRobin_IRQn);
+	priv_tmr_set(RoundRobin, (OS_FREQUENCY)/(OS_ROBIN), (OS_FREQUENCY)/(OS_ROBIN));
+
+	#endif//OS_ROBIN
+
+#endif//HW_TIMER_SIZE
+
+/******************************************************************************
+ End of configuration
+*******************************************************************************/
+}
+
+/* -------------------------------------------------------------------------- */
+
+void port_ctx_reset( void )
+{
+#if HW_TIMER_SIZE
+	#if OS_ROBIN
+	priv_tmr_set(RoundRobin, (OS_FREQUENCY)/(OS_ROBIN), (OS_FREQUENCY)/(OS_ROBIN));
+	#endif
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+
+void port_tmr_stop( void )
+{
+#if HW_TIMER_SIZE
+	priv_tmr_set(SysTick, 0, 0);
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+
+void port_tmr_start( uint64_t timeout )
+{
+#if HW_TIMER_SIZE
+	cnt_t delay = (cnt_t)(timeout - port_sys_time());
+	priv_tmr_set(SysTick, delay ? delay : 1, 0);
+#else
+	(void) timeout;
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+
+#if HW_TIMER_SIZE == 0 && OS_TICKLESS_IDLE
+
+#define NSEC_TICK ((uint64_t)1000000000 / (OS_FREQUENCY))
+
+static
+uint64_t priv_tmr_get( timer_t tmr )
+{
+	struct itimerspec its;
+
+	timer_gettime(tmr, &its);
+
+	return (uint64_t)its.it_value.tv_sec * 1000000000 + (uint64_t)its.it_value.tv_nsec;
+}
+
+static
+void priv_tmr_reload( timer_t tmr, uint64_t value )
+{
+	struct itimerspec its;
+
+	its.it_value.tv_sec     = (time_t)(value / 1000000000);
+	its.it_value.tv_nsec    = (long)  (value % 1000000000);
+	its.it_interval.tv_sec  = 0;
+	its.it_interval.tv_nsec = (long)NSEC_TICK;
+
+	timer_settime(tmr, 0, &its, NULL);
+}
+
+uint32_t port_sys_sleep( uint32_t delay )
+{
+	sigset_t set;
+	uint64_t value;
+	uint64_t ahead;
+	int      signo;
+
+	value = priv_tmr_get(SysTick);
+	if (value == 0)
+		return 0;
+
+//	the next system timer interrupt occurs 'delay' ticks later than expected
+	priv_tmr_reload(SysTick, value + delay * NSEC_TICK);
+
+//	interrupts are masked, so the signal remains pending (as with WFI)
+	sigemptyset(&set);
+	port_sig_fill(&set);
+	signo = sigwaitinfo(&set, NULL);
+
+	if (signo != SysTick_IRQn)
+	{
+	//	woken up before the end of the sleep; restore the tick phase
+		value = priv_tmr_get(SysTick);
+		ahead = value ? (value + NSEC_TICK - 1) / NSEC_TICK : 1;
+		value = value - (ahead - 1) * NSEC_TICK;
+		priv_tmr_reload(SysTick, value ? value : 1);
+		delay = delay + 1 - (uint32_t)ahead;
+	}
+
+	if (signo > 0)
+	//	the interrupt will be handled after unmasking
+		raise(signo);
+
+	return delay;
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_TRACE_SIZE
+
+void port_trc_write( const void *data, size_t size )
+{
+	const char *ptr = data;
+	ssize_t     len;
+	int         fd;
+
+	fd = open(OS_TRACE_FILE, O_WRONLY | O_CREAT | O_APPEND, 0644);
+	if (fd < 0)
+		return;
+
+	while (size > 0 && (len = write(fd, ptr, size)) > 0)
+	{
+		ptr  += len;
+		size -= (size_t)len;
+	}
+
+	close(fd);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
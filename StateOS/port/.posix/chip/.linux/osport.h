@@ -0,0 +1,197 @@
+/******************************************************************************
+
+    @file    StateOS: osport.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   StateOS port definitions for Linux host.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOSPORT_H
+#define __STATEOSPORT_H
+
+#include <stdint.h>
+#define   sig_t __sig_t // BSD type sig_t collides with the signal object
+#include <signal.h>
+#undef    sig_t
+#include <unistd.h>
+#include <time.h>
+#ifndef   NOCONFIG
+#include "osconfig.h"
+#endif
+#include "osdefs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------- */
+// signals are used as interrupts; all of them have the same (lowest) priority
+
+#define PendSV_IRQn     SIGUSR1 /* context switch                             */
+#define SysTick_IRQn    SIGALRM /* system timer                               */
+#define RoundRobin_IRQn SIGUSR2 /* context switch triggering in tick-less mode*/
+
+/* -------------------------------------------------------------------------- */
+// signal handlers run on the stack of the interrupted task;
+// every task stack is extended by the space for the signal frame of the host
+
+#ifdef  OS_FRAME_SIZE
+#error  OS_FRAME_SIZE is an internal os definition!
+#else
+#define OS_FRAME_SIZE      8192 /* space reserved for the signal frames       */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_FREQUENCY
+#define OS_FREQUENCY       1000 /* Hz */
+#endif
+
+/* -------------------------------------------------------------------------- */
+// !! WARNING! OS_TIMER_SIZE < HW_TIMER_SIZE may cause unexpected problems !!
+
+#ifndef OS_TIMER_SIZE
+#define OS_TIMER_SIZE        32 /* bit size of system timer counter           */
+#endif
+
+/* -------------------------------------------------------------------------- */
+// !! WARNING! OS_TIMER_SIZE < HW_TIMER_SIZE may cause unexpected problems !!
+
+#ifdef  HW_TIMER_SIZE
+#error  HW_TIMER_SIZE is an internal os definition!
+#elif   OS_FREQUENCY > 1000
+#define HW_TIMER_SIZE OS_TIMER_SIZE /* monotonic clock of the host            */
+#else
+#define HW_TIMER_SIZE         0 /* os does not work in tick-less mode         */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_ROBIN
+#define OS_ROBIN              0 /* system works in cooperative mode           */
+#endif
+
+#if     OS_ROBIN > OS_FREQUENCY
+#error  osconfig.h: Incorrect OS_ROBIN value!
+#endif
+
+/* -------------------------------------------------------------------------- */
+// return current system time
+
+#if HW_TIMER_SIZE >= OS_TIMER_SIZE
+
+__STATIC_INLINE
+uint64_t port_sys_time( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * (OS_FREQUENCY) + (uint64_t)ts.tv_nsec * (OS_FREQUENCY) / 1000000000;
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+// cycle counter; nanoseconds of the monotonic clock of the host
+
+#ifdef  CYC_FREQUENCY
+#error  CYC_FREQUENCY is an internal port definition!
+#else
+#define CYC_FREQUENCY 1000000000 /* Hz */
+#endif
+
+__STATIC_INLINE
+uint32_t port_cyc_time( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)ts.tv_sec * 1000000000U + (uint32_t)ts.tv_nsec;
+}
+
+/* -------------------------------------------------------------------------- */
+// force yield system control to the next process
+
+__STATIC_INLINE
+void port_ctx_switch( void )
+{
+	raise(PendSV_IRQn);
+}
+
+/* -------------------------------------------------------------------------- */
+// reset context switch indicator
+
+void port_ctx_reset( void );
+
+/* -------------------------------------------------------------------------- */
+// clear time breakpoint
+
+void port_tmr_stop( void );
+
+/* -------------------------------------------------------------------------- */
+// set time breakpoint
+
+void port_tmr_start( uint64_t timeout );
+
+/* -------------------------------------------------------------------------- */
+// suppress system timer interrupts for at most 'delay' ticks and wait for any interrupt
+// return number of the ticks elapsed without system timer interrupts
+
+#if HW_TIMER_SIZE == 0 && OS_TICKLESS_IDLE
+uint32_t port_sys_sleep( uint32_t delay );
+#endif
+
+/* -------------------------------------------------------------------------- */
+// append the trace dump to the file OS_TRACE_FILE
+
+#if OS_TRACE_SIZE
+
+#ifndef OS_TRACE_FILE
+#define OS_TRACE_FILE "trace.bin"
+#endif
+
+void port_trc_write( const void *data, size_t size );
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+// force timer interrupt
+
+__STATIC_INLINE
+void port_tmr_force( void )
+{
+#if HW_TIMER_SIZE
+	raise(SysTick_IRQn);
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOSPORT_H
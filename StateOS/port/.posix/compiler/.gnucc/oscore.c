@@ -0,0 +1,105 @@
+/******************************************************************************
+
+    @file    StateOS: oscore.c
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   StateOS port file for POSIX host.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "oskernel.h"
+#include "inc/ostask.h"
+
+/* -------------------------------------------------------------------------- */
+
+volatile int port_isr_nest = 0;
+
+/* -------------------------------------------------------------------------- */
+
+// the new context of the task uses the free part of its stack, from the base of the stack up to 'sp'
+// the main task runs on the stack of the process (its base is not known), it is given OS_STACK_SIZE bytes below 'sp'
+// (the main task flipped with tsk_flip runs on its own stack of OS_STACK_SIZE bytes ending at 'sp')
+static
+void priv_ctx_make( ucontext_t *uc, tsk_t *tsk, void *sp, fun_t *pc )
+{
+	char *top  = sp;
+	char *base = tsk == &MAIN ? top - OS_STACK_SIZE : (char *) tsk->stack;
+
+	assert(base < top);
+
+	getcontext(uc);
+	port_sig_fill(&uc->uc_sigmask); // new context starts inside critical section
+	uc->uc_link = NULL;
+	uc->uc_stack.ss_sp = base;
+	uc->uc_stack.ss_size = (size_t)(top - base);
+	makecontext(uc, pc, 0);
+}
+
+/* -------------------------------------------------------------------------- */
+
+void PendSV_Handler( int signo )
+{
+	static
+	ucontext_t uc; // context of a new task, used inside the handler only
+	struct { ctx_t ctx; ucontext_t uc; } cur; // context of the current task
+	ctx_t *nxt;
+
+	(void) signo;
+
+	cur.ctx.uc = &cur.uc;
+	cur.ctx.pc = NULL;
+
+	port_isr_nest++;
+	nxt = core_tsk_handler(&cur.ctx);
+	port_isr_nest--;
+
+	if (nxt == &cur.ctx)
+		return;
+
+	if (nxt->uc == NULL)
+	{
+		priv_ctx_make(&uc, System.cur, (char *)nxt - CTX_GAP, nxt->pc);
+		swapcontext(&cur.uc, &uc);
+	}
+	else
+	{
+		swapcontext(&cur.uc, nxt->uc);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tsk_flip( void *sp )
+{
+	static
+	ucontext_t uc; // used inside critical section only
+
+	priv_ctx_make(&uc, System.cur, sp, core_tsk_loop);
+	setcontext(&uc);
+
+	abort();
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,191 @@
+/******************************************************************************
+
+    @file    StateOS: oscore.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   StateOS port file for POSIX host.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOSCORE_H
+#define __STATEOSCORE_H
+
+#include <ucontext.h>
+#include "osbase.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------- */
+// !! WARNING! with OS_HEAP_SIZE == 0 the libc allocator is used; it is not   !!
+// !! protected against preemption, so tasks must not call malloc/free then  !!
+
+#ifndef OS_HEAP_SIZE
+#define OS_HEAP_SIZE          0 /* default system heap: all free memory       */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_STACK_SIZE
+#define OS_STACK_SIZE      1024 /* default task stack size in bytes           */
+#endif
+
+#ifndef OS_IDLE_STACK
+#define OS_IDLE_STACK       256 /* idle task stack size in bytes              */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_LOCK_LEVEL
+#define OS_LOCK_LEVEL         0 /* critical section blocks all interrupts     */
+#endif
+
+#if     OS_LOCK_LEVEL > 0
+#error  osconfig.h: Incorrect OS_LOCK_LEVEL value! Must be 0.
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_MAIN_PRIO
+#define OS_MAIN_PRIO          0 /* priority of main process                   */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+typedef unsigned              lck_t;
+typedef uint64_t              stk_t;
+
+/* -------------------------------------------------------------------------- */
+// task context
+// the host context (ucontext_t) is too big to be placed at the top of a small
+// task stack; it is stored in the frame of the suspended PendSV handler instead
+
+typedef struct __ctx ctx_t;
+
+struct __ctx
+{
+	ucontext_t *uc; // saved context of the suspended task
+	fun_t      *pc; // entry point of the new context (uc == NULL)
+};
+
+#define _CTX_INIT( pc ) { NULL, pc }
+
+// room left for the frame of the suspended PendSV handler below the context
+#define  CTX_GAP            256
+
+/* -------------------------------------------------------------------------- */
+// nesting level of signal handlers (interrupts)
+
+extern volatile int port_isr_nest;
+
+/* -------------------------------------------------------------------------- */
+// set of signals used as interrupts
+
+__STATIC_INLINE
+void port_sig_fill( sigset_t *set )
+{
+	sigaddset(set, PendSV_IRQn);
+	sigaddset(set, SysTick_IRQn);
+	sigaddset(set, RoundRobin_IRQn);
+}
+
+/* -------------------------------------------------------------------------- */
+// init task context
+
+__STATIC_INLINE
+void port_ctx_init( ctx_t *ctx, fun_t *pc )
+{
+	ctx->uc = NULL;
+	ctx->pc = pc;
+}
+
+/* -------------------------------------------------------------------------- */
+// is procedure inside ISR?
+
+__STATIC_INLINE
+bool port_isr_context( void )
+{
+	return (port_isr_nest != 0);
+}
+
+/* -------------------------------------------------------------------------- */
+// get current stack pointer
+
+__STATIC_INLINE
+void * port_get_sp( void )
+{
+	return __builtin_frame_address(0);
+}
+
+/* -------------------------------------------------------------------------- */
+
+__STATIC_INLINE
+lck_t port_get_lock( void )
+{
+	sigset_t set;
+	sigprocmask(SIG_BLOCK, NULL, &set);
+	return (lck_t) sigismember(&set, PendSV_IRQn);
+}
+
+__STATIC_INLINE
+void port_put_lock( lck_t lck )
+{
+	sigset_t set;
+	if (lck == 0 && port_isr_context())
+		return; // handlers of the same priority do not preempt each other
+	sigemptyset(&set);
+	port_sig_fill(&set);
+	sigprocmask(lck ? SIG_BLOCK : SIG_UNBLOCK, &set, NULL);
+}
+
+__STATIC_INLINE
+void port_set_lock( void )
+{
+	port_put_lock(1);
+}
+
+__STATIC_INLINE
+void port_clr_lock( void )
+{
+	port_put_lock(0);
+}
+
+/* -------------------------------------------------------------------------- */
+// are interrupts masked?
+
+__STATIC_INLINE
+bool port_isr_masked( void )
+{
+	return (port_get_lock() != 0U);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//__STATEOSCORE_H
@@ -72,6 +72,14 @@ extern "C" {
 #define HW_TIMER_SIZE         0 /* os does not work in tick-less mode         */
 #endif
 
+#if     HW_TIMER_SIZE == 0 && defined(OS_TICKLESS_IDLE) && OS_TICKLESS_IDLE
+#error  osconfig.h: OS_TICKLESS_IDLE is not supported by the port!
+#endif
+
+#if     defined(OS_TRACE_SIZE) && OS_TRACE_SIZE
+#error  osconfig.h: OS_TRACE_SIZE is not supported by the port!
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 #ifndef OS_ROBIN
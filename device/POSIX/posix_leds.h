@@ -0,0 +1,55 @@
+/******************************************************************************
+ * @file    posix_leds.h
+ * @author  Rajmund Szymanski
+ * @date    18.10.2026
+ * @brief   This file contains definitions of leds emulated on POSIX host.
+ ******************************************************************************/
+
+#ifndef __POSIX_LEDS_H
+#define __POSIX_LEDS_H
+
+#include <stdbool.h>
+
+#ifdef  __cplusplus
+extern "C" {
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+static inline
+volatile unsigned *LED_Port( void )
+{
+	static volatile unsigned port = 0;
+	return &port;
+}
+
+#define     LEDs (*LED_Port()) // leds array
+
+/* -------------------------------------------------------------------------- */
+
+// init leds
+
+static inline
+void LED_Init( void )
+{
+	LEDs = 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+// rotate leds
+
+static inline
+void LED_Tick( void )
+{
+	unsigned leds = (LEDs << 1) & 0xE;
+	LEDs = leds ? leds : 0x1;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef  __cplusplus
+}
+#endif//__cplusplus
+
+#endif//__POSIX_LEDS_H
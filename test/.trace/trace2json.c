@@ -0,0 +1,237 @@
+/******************************************************************************
+
+    @file    StateOS: trace2json.c
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   Host tool converting the StateOS trace dump into the Chrome trace
+             event format (JSON), viewable in chrome://tracing or Perfetto.
+
+             build: gcc -O2 -o trace2json trace2json.c
+             usage: trace2json [trace.bin [trace.json]]
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/* -------------------------------------------------------------------------- */
+// must be consistent with the definitions in StateOS/kernel/inc/ostrace.h
+
+#define TRC_MAGIC         0x43525453UL
+#define TRC_VERSION       1
+
+enum { trcSwitch = 1, trcWait, trcWakeup, trcTimer, trcLost, trcGive, trcTake };
+
+#define MAX_TASKS       256
+
+/* -------------------------------------------------------------------------- */
+
+static const uint8_t *data;      // contents of the trace dump
+static size_t         size;      // size of the trace dump
+static FILE         * out;       // output file
+
+static uint64_t       obj[MAX_TASKS]; // known tasks; index of the task is its thread id
+static int            run[MAX_TASKS]; // the task is running (the duration event is open)
+static unsigned       tasks;
+
+static const char   * sep = "";  // separator of the json events
+
+/* -------------------------------------------------------------------------- */
+// little-endian fields of the dump
+
+static uint32_t get32( const uint8_t *ptr )
+{
+	return (uint32_t)ptr[0] | (uint32_t)ptr[1] << 8 | (uint32_t)ptr[2] << 16 | (uint32_t)ptr[3] << 24;
+}
+
+static uint64_t getptr( const uint8_t *ptr, unsigned len )
+{
+	return len == 8 ? get32(ptr) | (uint64_t)get32(ptr + 4) << 32 : get32(ptr);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static unsigned tid( uint64_t ptr )
+{
+	unsigned i;
+
+	for (i = 0; i < tasks; i++)
+		if (obj[i] == ptr)
+			return i + 1;
+
+	if (tasks == MAX_TASKS)
+		return 0;
+
+	obj[tasks++] = ptr;
+	fprintf(out, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"task 0x%llx\"}}",
+	             sep, tasks, (unsigned long long)ptr);
+	sep = ",";
+	return tasks;
+}
+
+static const char *event( uint32_t evt )
+{
+	static char buf[16];
+
+	switch (evt)
+	{
+	case 0x00000000: return "E_SUCCESS";
+	case 0xFFFFFFFF: return "E_FAILURE";
+	case 0xFFFFFFFE: return "E_STOPPED";
+	case 0xFFFFFFFD: return "E_DELETED";
+	case 0xFFFFFFFC: return "E_TIMEOUT";
+	}
+
+	sprintf(buf, "%lu", (unsigned long)evt);
+	return buf;
+}
+
+static void instant( const char *name, unsigned id, double ts, const char *key, const char *val )
+{
+	fprintf(out, "%s\n{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"%s\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"args\":{\"%s\":\"%s\"}}",
+	             sep, name, id ? "t" : "g", id, ts, key, val);
+	sep = ",";
+}
+
+static void duration( const char *ph, unsigned id, double ts )
+{
+	fprintf(out, "%s\n{\"name\":\"running\",\"ph\":\"%s\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}",
+	             sep, ph, id, ts);
+	sep = ",";
+}
+
+/* -------------------------------------------------------------------------- */
+// convert one block of the dump (header and the following records)
+// return position of the next block
+
+static size_t block( size_t pos )
+{
+	uint32_t len  = get32(data + pos + 8);
+	uint32_t ptr  = get32(data + pos + 12);
+	uint32_t freq = get32(data + pos + 16);
+	uint32_t prev = pos + 24 <= size ? get32(data + pos + 20) : 0; // timestamp of the first record
+	uint64_t time = 0;
+	char     buf[32];
+	unsigned id;
+	double   ts   = 0;
+
+	if (get32(data + pos + 4) != TRC_VERSION || (ptr != 4 && ptr != 8) || len < 8 + 2 * ptr || freq == 0)
+	{
+		fprintf(stderr, "trace2json: invalid header at offset %lu\n", (unsigned long)pos);
+		exit(EXIT_FAILURE);
+	}
+
+	for (pos += 20; pos + len <= size && get32(data + pos) != TRC_MAGIC; pos += len)
+	{
+		const uint8_t *rec = data + pos;
+		uint32_t stamp = get32(rec);
+		uint32_t type  = get32(rec + 4);
+		uint64_t o     = getptr(rec + 8, ptr);
+		uint64_t a     = getptr(rec + 8 + ptr, ptr);
+
+		time += (uint32_t)(stamp - prev); // the cycle counter wraps around
+		prev  = stamp;
+		ts    = (double)time * 1e6 / freq;
+
+		switch (type)
+		{
+		case trcSwitch:
+			if (a && (id = tid(a)) != 0 && run[id - 1]) { duration("E", id, ts); run[id - 1] = 0; }
+			if (o && (id = tid(o)) != 0)                { duration("B", id, ts); run[id - 1] = 1; }
+			break;
+		case trcWait:
+			sprintf(buf, "0x%llx", (unsigned long long)a);
+			instant("wait", tid(o), ts, "object", buf);
+			break;
+		case trcWakeup:
+			instant("wakeup", tid(o), ts, "event", event((uint32_t)a));
+			break;
+		case trcTimer:
+			sprintf(buf, "0x%llx", (unsigned long long)o);
+			instant("timer", 0, ts, "timer", buf);
+			break;
+		case trcLost:
+			sprintf(buf, "%llu", (unsigned long long)a);
+			instant("lost", 0, ts, "records", buf);
+			break;
+		case trcGive:
+			sprintf(buf, "0x%llx", (unsigned long long)o);
+			instant("give", tid(a), ts, "object", buf);
+			break;
+		case trcTake:
+			sprintf(buf, "0x%llx", (unsigned long long)o);
+			instant("take", tid(a), ts, "object", buf);
+			break;
+		default:
+			fprintf(stderr, "trace2json: unknown record type %lu at offset %lu\n", (unsigned long)type, (unsigned long)pos);
+			break;
+		}
+	}
+
+	for (id = 1; id <= tasks; id++)
+		if (run[id - 1]) { duration("E", id, ts); run[id - 1] = 0; }
+
+	return pos;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( int argc, char *argv[] )
+{
+	FILE  *inp = stdin;
+	uint8_t *buf = NULL;
+	size_t pos;
+	size_t len;
+
+	if (argc > 1 && (inp = fopen(argv[1], "rb")) == NULL) { perror(argv[1]); return EXIT_FAILURE; }
+	out = stdout;
+	if (argc > 2 && (out = fopen(argv[2], "w"))  == NULL) { perror(argv[2]); return EXIT_FAILURE; }
+
+	for (;;)
+	{
+		buf = realloc(buf, size + 4096);
+		if (buf == NULL) { perror("trace2json"); return EXIT_FAILURE; }
+		len = fread(buf + size, 1, 4096, inp);
+		size += len;
+		if (len < 4096) break;
+	}
+	data = buf;
+
+	fprintf(out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+	for (pos = 0; pos + 20 <= size; )
+	{
+		if (get32(data + pos) != TRC_MAGIC)
+		{
+			fprintf(stderr, "trace2json: missing header at offset %lu\n", (unsigned long)pos);
+			return EXIT_FAILURE;
+		}
+		pos = block(pos);
+	}
+	fprintf(out, "\n]}\n");
+
+	free(buf);
+	return EXIT_SUCCESS;
+}
@@ -31,6 +31,11 @@
 
 #pragma once
 
+// ----------------------------
+// optional features of the kernel
+// TEST_OPTIONS undefined => optional features are disabled (the default configuration)
+// TEST_OPTIONS defined   => optional features are enabled, e.g.: make -f makefile.posix DEFS="DEBUG TEST_OPTIONS"
+
 // ----------------------------
 // cpu frequency in Hz
 // default value: 168000000
@@ -46,7 +51,33 @@
 // OS_ROBIN == 0 => os works in cooperative mode
 // OS_ROBIN >  0 => os works in preemptive mode, OS_ROBIN indicates round-robin frequency
 // default value: 0
+#ifndef __linux__
 #define OS_ROBIN           1000
+#else // posix host: context switch is much slower than on the target
+#define OS_ROBIN            250
+#endif
+
+// ----------------------------
+// suppression of system timer interrupts when the system is idle (non-tick-less mode only)
+// OS_TICKLESS_IDLE == 0 => system timer generates interrupts with frequency OS_FREQUENCY all the time
+// OS_TICKLESS_IDLE >  0 => when there is no task ready to run, system timer interrupts are suppressed until the nearest timer expires
+// default value: 0
+#ifdef TEST_OPTIONS
+#define OS_TICKLESS_IDLE      1
+#else
+#define OS_TICKLESS_IDLE      0
+#endif
+
+// ----------------------------
+// execution of the timer callback procedures
+// OS_TIMER_TASK == 0 => callback procedures are executed in the system timer interrupt handler
+// OS_TIMER_TASK >  0 => callback procedures are executed by the timer task with interrupts enabled, OS_TIMER_TASK indicates priority of the timer task
+// default value: 0
+#ifdef TEST_OPTIONS
+#define OS_TIMER_TASK       255
+#else
+#define OS_TIMER_TASK         0
+#endif
 
 // ----------------------------
 // critical sections protection level
@@ -55,22 +86,108 @@
 // default value: 0
 #define OS_LOCK_LEVEL         0
 
+// ----------------------------
+// number of the traced critical sections (size of the table of statistics)
+// OS_LOCK_TRACE == 0 => critical sections are not traced
+// OS_LOCK_TRACE >  0 => duration of every critical section is measured, statistics are available with the sys_lockStats function
+// default value: 0
+#ifdef TEST_OPTIONS
+#define OS_LOCK_TRACE       256
+#else
+#define OS_LOCK_TRACE         0
+#endif
+
+// ----------------------------
+// size of the buffer of the kernel event trace (number of records, power of 2)
+// OS_TRACE_SIZE == 0 => kernel events are not traced
+// OS_TRACE_SIZE >  0 => context switches, blocking and release of the tasks and expirations of the timers are recorded into the ring buffer, records are available with the sys_traceRead and sys_traceDump functions
+// default value: 0
+#ifdef TEST_OPTIONS
+#define OS_TRACE_SIZE       256
+#else
+#define OS_TRACE_SIZE         0
+#endif
+
+// ----------------------------
+// run time statistics of the tasks
+// OS_TASK_STATS == 0 => run time of the tasks is not measured
+// OS_TASK_STATS >  0 => run time of every task is measured with the cycle counter, statistics are available with the tsk_getRunTime and sys_getLoad functions
+// default value: 0
+#ifdef TEST_OPTIONS
+#define OS_TASK_STATS         1
+#else
+#define OS_TASK_STATS         0
+#endif
+
 // ----------------------------
 // priority of main process
 // default value: 0 (the same as priority of idle process)
 #define OS_MAIN_PRIO          0
 
+// ----------------------------
+// number of priority levels indexed by the bitmap of the READY queue (max 32)
+// OS_PRIO_LEVELS == 0 => task is inserted into the READY queue by the linear search
+// OS_PRIO_LEVELS >  0 => task is inserted into the READY queue in constant time; priorities greater than or equal to (OS_PRIO_LEVELS - 1) share the last level
+// default value: 0
+#ifdef TEST_OPTIONS
+#define OS_PRIO_LEVELS        8
+#else
+#define OS_PRIO_LEVELS        0
+#endif
+
+// ----------------------------
+// number of slots of the timing wheel (power of 2, max 32)
+// OS_TIMER_WHEEL == 0 => timer is inserted into the timers queue by the linear search
+// OS_TIMER_WHEEL >  0 => timer expiring after the current slot is inserted into the timing wheel in constant time
+// default value: 0
+#ifdef TEST_OPTIONS
+#define OS_TIMER_WHEEL        4
+#else
+#define OS_TIMER_WHEEL        0
+#endif
+
+// ----------------------------
+// time span of the slot of the timing wheel in system ticks (power of 2)
+// in tick-less mode it should be adequate to the os frequency
+// default value: 1
+#define OS_TIMER_SLOT         2
+
+// ----------------------------
+// number of levels of the timing wheel (max 4)
+// timer expiring beyond (OS_TIMER_SLOT * OS_TIMER_WHEEL^OS_TIMER_LEVELS) ticks is cascaded again from the highest level
+// default value: 2
+#define OS_TIMER_LEVELS       2
+
 // ----------------------------
 // os heap size in bytes
 // OS_HEAP_SIZE == 0 => functions 'xxx_create' use 'malloc' provided with the compiler libraries
 // OS_HEAP_SIZE >  0 => functions 'xxx_create' allocate memory on a dedicated system heap, OS_HEAP_SIZE indicates size of the heap
 // default value: 0
+#ifndef __linux__
 #define OS_HEAP_SIZE      16384
+#else // posix host: stacks of the tasks are extended by the signal frames
+#define OS_HEAP_SIZE    1048576
+#endif
+
+// ----------------------------
+// allocator of the system heap
+// OS_HEAP_TLSF == 0 => memory segment is searched for by the first-fit method (in linear time)
+// OS_HEAP_TLSF >  0 => memory segment is taken from the segregated lists of free segments (TLSF, in constant time)
+// default value: 0
+#ifdef TEST_OPTIONS
+#define OS_HEAP_TLSF          1
+#else
+#define OS_HEAP_TLSF          0
+#endif
 
 // ----------------------------
 // default task stack size in bytes
 // default value: 256
+#ifndef __linux__
 #define OS_STACK_SIZE      1024
+#else // posix host: user-supplied stacks must also hold the signal frames
+#define OS_STACK_SIZE     16384
+#endif
 
 // ----------------------------
 // idle task stack size in bytes
@@ -1,7 +1,7 @@
 #include "test.h"
 
 #define       LOOP 1
-#define       SIZE 68
+#define       SIZE 128
 
 static cnt_t  summary = 0;
 static fun_t *test[SIZE];
@@ -67,12 +67,24 @@ int main()
 	TEST_AddUnit(test_condition_variable);
 	TEST_AddUnit(test_memory_pool);
 	TEST_AddUnit(test_stream_buffer);
+	TEST_AddUnit(test_pipe);
 	TEST_AddUnit(test_message_buffer);
 	TEST_AddUnit(test_mailbox_queue);
 	TEST_AddUnit(test_event_queue);
 	TEST_AddUnit(test_job_queue);
 	TEST_AddUnit(test_timer);
+	TEST_AddUnit(test_select);
+	TEST_AddUnit(test_lightweight_task);
+	TEST_AddUnit(test_active_object);
+	TEST_AddUnit(test_state_machine);
+	TEST_AddUnit(test_coroutine);
 	TEST_AddUnit(test_task);
+#if OS_TRACE_SIZE
+	TEST_AddUnit(test_trace);
+#endif
+#if OS_LOCK_TRACE
+	TEST_AddUnit(test_critical_section);
+#endif
 
 	size_t h = sys_heapSize();
 	for (i = 0; i < count * LOOP * 2; i += 2)
@@ -85,7 +97,12 @@ int main()
 		ASSERT(h==sys_heapSize());
 	}
 
+#ifdef BENCH
+	TEST_AddUnit(test_bench);
+#endif
 	test_fini();
-
+#ifdef __linux__
+	return 0;
+#endif
 	tsk_stop();
 }
@@ -1,4 +1,8 @@
+#ifndef __linux__
 #include <stm32f4_discovery.h>
+#else
+#include <posix_leds.h>
+#endif
 #include <os.h>
 #include <stdio.h>
 #include "test_resources.h"
@@ -30,6 +34,14 @@ extern "C" {
 void test_add (fun_t *fun);
 void test_call(fun_t *fun);
 
+void bench_print(const char *name, unsigned n, cnt_t time, unsigned long count);
+
+typedef struct { uint32_t min, max; uint64_t sum; unsigned long count; } bench_t;
+
+void bench_start(bench_t *bench);
+void bench_count(bench_t *bench, uint32_t cycles);
+void bench_stats(const char *name, const bench_t *bench);
+
 #ifdef  __cplusplus
 }
 #endif
@@ -37,6 +49,7 @@ void test_call(fun_t *fun);
 #define TEST_Add(fun)          do { void fun (void); test_add(fun); } while (0)
 #define TEST_AddUnit(unit)     do { void unit(void); unit();        } while (0)
 #define TEST_Call()            do { test_call(test);                } while (0)
+#define BENCH_Run(bench)       do { void bench(void); bench();      } while (0)
 
 #ifdef  DEBUG
 #ifdef  __CSMC__
@@ -0,0 +1,10 @@
+#include "test.h"
+
+void test_active_object()
+{
+	UNIT_Notify();
+	TEST_Add(test_active_object_1);
+#ifndef __CSMC__
+	TEST_Add(test_active_object_2);
+#endif
+}
@@ -0,0 +1,100 @@
+#include "test.h"
+
+enum { EVT_DATA, EVT_TICK, EVT_LIMIT };
+
+typedef struct { aev_t aev; unsigned data; } data_t;
+
+static void handler( aob_t *, const aev_t * );
+
+static_MEM(mem3, 2, sizeof(data_t));
+static_AOB(aob2, 2, handler);
+static_AOB(aob3, 2, handler);
+static_BUS(bus3, EVT_LIMIT);
+
+static const aev_t tick = AEV_INIT(EVT_TICK);
+
+static unsigned sum2, sum3;
+
+static void handler( aob_t *aob, const aev_t *aev )
+{
+	unsigned *sum = aob == aob2 ? &sum2 : &sum3;
+
+	if (aev->signal == EVT_DATA)
+	        *sum += ((const data_t *)aev)->data;
+	else
+	        *sum += 1;
+}
+
+static void proc2()
+{
+	if (aob_wait(aob2) != E_SUCCESS)
+	        tsk_stop();
+}
+
+static void proc3()
+{
+	if (aob_wait(aob3) != E_SUCCESS)
+	        tsk_stop();
+}
+
+static void test()
+{
+	data_t * evt[3];
+	unsigned data;
+	unsigned event;
+
+	        mem_bind(mem3);
+	        sum2 = sum3 = 0;
+	event = bus_subscribe(bus3, aob2, EVT_DATA); ASSERT_success(event);
+	event = bus_subscribe(bus3, aob3, EVT_DATA); ASSERT_success(event);
+	event = bus_subscribe(bus3, aob3, EVT_TICK); ASSERT_success(event);
+		                                         ASSERT_dead(tsk2);
+	        tsk_startFrom(tsk2, proc2);          ASSERT_ready(tsk2);
+		                                         ASSERT_dead(tsk3);
+	        tsk_startFrom(tsk3, proc3);          ASSERT_ready(tsk3);
+	// the dynamic event is shared by all the subscribers and recycled after the last one has handled it
+	evt[0] = (data_t *)aev_alloc(mem3, EVT_DATA);ASSERT(evt[0]);
+	        data = evt[0]->data = (unsigned)rand() / 2;
+	event = bus_publish(bus3, &evt[0]->aev);     ASSERT(event == 2);
+	                                             ASSERT(sum2 == data && sum3 == data);
+	event = bus_publish(bus3, &tick);            ASSERT(event == 1);
+	                                             ASSERT(sum2 == data && sum3 == data + 1);
+	evt[0] = (data_t *)aev_alloc(mem3, EVT_DATA);ASSERT(evt[0]);
+	evt[1] = (data_t *)aev_alloc(mem3, EVT_DATA);ASSERT(evt[1]);
+	evt[2] = (data_t *)aev_alloc(mem3, EVT_DATA);ASSERT(evt[2] == NULL);
+	// the dynamic event without any recipient is recycled immediately
+	        bus_unsubscribe(bus3, aob2, EVT_DATA);
+	        bus_unsubscribe(bus3, aob3, EVT_DATA);
+	// the entry of the active object is released when it is not subscribed to any signal
+	                                             ASSERT(bus3->list[0] == NULL && bus3->list[1] == aob3);
+	event = bus_publish(bus3, &evt[0]->aev);     ASSERT(event == 0);
+	// the dynamic event is recycled when the event queue is full
+	        tsk_prio(3);
+	event = aob_post(aob2, &tick);               ASSERT_success(event);
+	event = aob_post(aob2, &tick);               ASSERT_success(event);
+	event = aob_post(aob2, &tick);               ASSERT_success(event);
+	event = aob_post(aob2, &evt[1]->aev);        ASSERT_timeout(event);
+	        tsk_prio(0);                         ASSERT(sum2 == data + 3);
+	evt[0] = (data_t *)aev_alloc(mem3, EVT_DATA);ASSERT(evt[0]);
+	evt[1] = (data_t *)aev_alloc(mem3, EVT_DATA);ASSERT(evt[1]);
+	        aob_reset(aob2);
+	        aob_reset(aob3);
+	event = tsk_join(tsk2);                      ASSERT_success(event);
+	event = tsk_join(tsk3);                      ASSERT_success(event);
+	                                             ASSERT(sum3 == data + 1);
+	// reset of the active object recycles the queued events
+	event = aob_post(aob3, &evt[0]->aev);        ASSERT_success(event);
+	event = aob_post(aob3, &evt[1]->aev);        ASSERT_success(event);
+	        aob_reset(aob3);
+	event = aob_take(aob3);                      ASSERT_timeout(event);
+	evt[0] = (data_t *)aev_alloc(mem3, EVT_DATA);ASSERT(evt[0]);
+	evt[1] = (data_t *)aev_alloc(mem3, EVT_DATA);ASSERT(evt[1]);
+	event = bus_publish(bus3, &evt[0]->aev);     ASSERT(event == 0);
+	event = bus_publish(bus3, &evt[1]->aev);     ASSERT(event == 0);
+}
+
+void test_active_object_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
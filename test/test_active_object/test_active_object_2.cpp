@@ -0,0 +1,48 @@
+#include "test.h"
+
+static void handler( aob_t *, const aev_t * );
+
+static ActiveObjectT<2> aob3(handler);
+static EventBusT<1> bus3;
+static TimeEvent tev3(aob3, 0);
+static ActiveEvent aev3(0);
+
+static unsigned received;
+
+static void handler( aob_t *aob, const aev_t *aev )
+{
+	                                             ASSERT(aob == &aob3);
+	                                             ASSERT(aev->signal == 0);
+	        received++;
+}
+
+static void test()
+{
+	unsigned event;
+
+	        received = 0;
+	event = bus3.subscribe(aob3, 0);             ASSERT_success(event);
+	event = bus3.publish(&aev3);                 ASSERT(event == 1);
+	event = aob3.take();                         ASSERT_success(event);
+	                                             ASSERT(received == 1);
+	event = aob3.take();                         ASSERT_timeout(event);
+	// the time event is posted to the active object by the timer
+	        tev3.startFor(MSEC);
+	event = aob3.wait();                         ASSERT_success(event);
+	                                             ASSERT(received == 2);
+	event = aob3.waitFor(2 * MSEC);              ASSERT_timeout(event);
+	        tev3.startPeriodic(MSEC);
+	event = aob3.wait();                         ASSERT_success(event);
+	event = aob3.wait();                         ASSERT_success(event);
+	        tev3.stop();
+	        aob3.reset();                        ASSERT(received == 4);
+	        bus3.unsubscribe(aob3, 0);
+	event = bus3.publish(&aev3);                 ASSERT(event == 0);
+}
+
+extern "C"
+void test_active_object_2()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -9,4 +9,6 @@ void test_alloc()
 #ifndef __CSMC__
 	TEST_Add(test_alloc_3);
 #endif
+	TEST_Add(test_alloc_4);
+	TEST_Add(test_alloc_5);
 }
@@ -0,0 +1,32 @@
+#include "test.h"
+
+#define SIZE 256
+
+static void test()
+{
+	size_t heap = sys_heapSize();
+	size_t len1 = (rand() % (SIZE / 64) + 1) * 64;
+	size_t len2 =  rand() % (SIZE) + 1;
+	size_t len3 = (rand() % (SIZE / 64) + 1) * 256;
+	void * buf1 = aligned_alloc(64, len1);       ASSERT(buf1);
+	                                             ASSERT(((uintptr_t)buf1 % 64) == 0);
+	void * buf2 = malloc(len2);                  ASSERT(buf2);
+	                                             ASSERT(((uintptr_t)buf2 % sizeof(stk_t)) == 0);
+	void * buf3 = aligned_alloc(256, len3);      ASSERT(buf3);
+	                                             ASSERT(((uintptr_t)buf3 % 256) == 0);
+	memset(buf1, 0xFF, len1);
+	memset(buf2, 0xFF, len2);
+	memset(buf3, 0xFF, len3);
+	                                             ASSERT(sys_segSize(buf1) >= len1);
+	                                             ASSERT(sys_segSize(buf2) >= len2);
+	                                             ASSERT(sys_segSize(buf3) >= len3);
+	free(buf2);
+	free(buf1);
+	free(buf3);                                  ASSERT(heap==sys_heapSize());
+}
+
+void test_alloc_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,33 @@
+#include "test.h"
+
+#define SIZE 256
+
+static void test()
+{
+	hst_t  hst1, hst2, hst3;
+	size_t len  = rand() % (SIZE) + 1;
+	void * buf;
+
+	sys_heapStats(&hst1);                        ASSERT(hst1.size == sys_heapSize());
+	                                             ASSERT(hst1.max <= hst1.size);
+	                                             ASSERT(hst1.peak >= hst1.used);
+	buf = malloc(len);                           ASSERT(buf);
+	sys_heapStats(&hst2);                        ASSERT(hst2.taken == hst1.taken + 1);
+	                                             ASSERT(hst2.used >= hst1.used + len);
+	                                             ASSERT(hst2.size <= hst1.size - len);
+	                                             ASSERT(hst2.peak >= hst2.used);
+	free(buf);
+	sys_heapStats(&hst3);                        ASSERT(hst3.size == hst1.size);
+	                                             ASSERT(hst3.max == hst1.max);
+	                                             ASSERT(hst3.used == hst1.used);
+	                                             ASSERT(hst3.peak == hst2.peak);
+	                                             ASSERT(hst3.free == hst1.free);
+	                                             ASSERT(hst3.taken == hst1.taken);
+	                                             ASSERT(hst3.fails == hst1.fails);
+}
+
+void test_alloc_5()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,49 @@
+#include "test.h"
+
+void bench_print(const char *name, unsigned n, cnt_t time, unsigned long count)
+{
+	unsigned long ns = (unsigned long)((uint64_t)time * 1000000000U / (OS_FREQUENCY) / count);
+	printf("%-24s %4u: %8lu ns/op\n", name, n, ns);
+}
+
+void bench_start(bench_t *bench)
+{
+	bench->min = UINT32_MAX;
+	bench->max = 0;
+	bench->sum = 0;
+	bench->count = 0;
+}
+
+void bench_count(bench_t *bench, uint32_t cycles)
+{
+	if (bench->min > cycles) bench->min = cycles;
+	if (bench->max < cycles) bench->max = cycles;
+	bench->sum += cycles;
+	bench->count++;
+}
+
+// cycles of the cycle counter (CYC_FREQUENCY) per operation
+void bench_stats(const char *name, const bench_t *bench)
+{
+	unsigned long avg = bench->count ? (unsigned long)(bench->sum / bench->count) : 0;
+	unsigned long min = bench->count ? (unsigned long)bench->min : 0;
+	printf("%-24s     : %8lu min, %8lu avg, %8lu max cycles/op\n", name, min, avg, (unsigned long)bench->max);
+}
+
+void test_bench()
+{
+	UNIT_Notify();
+	BENCH_Run(test_bench_ready_queue);
+	BENCH_Run(test_bench_timer_queue);
+	BENCH_Run(test_bench_buffers);
+	BENCH_Run(test_bench_memory_pool);
+	BENCH_Run(test_bench_heap);
+	BENCH_Run(test_bench_context_switch);
+	BENCH_Run(test_bench_messages);
+	BENCH_Run(test_bench_active_object);
+	BENCH_Run(test_bench_state_machine);
+	BENCH_Run(test_bench_allocation);
+	BENCH_Run(test_bench_barrier);
+	BENCH_Run(test_bench_broadcast);
+	BENCH_Run(test_bench_lock_stats);
+}
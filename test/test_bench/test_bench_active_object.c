@@ -0,0 +1,81 @@
+#include "test.h"
+
+#define LOOPS 100000UL
+
+enum { EVT_DATA, EVT_LIMIT };
+
+typedef struct { aev_t aev; unsigned data; } data_t;
+
+static void handler( aob_t *, const aev_t * );
+
+static_MEM(mem, 4, sizeof(data_t));
+static_AOB(aob0, 4, handler);
+static_AOB(aob1, 4, handler);
+static_BUS(bus, EVT_LIMIT);
+
+static tsk_t  * tsk[2];
+static volatile
+unsigned long   counter;
+
+static void handler( aob_t *aob, const aev_t *aev )
+{
+	(void) aob;
+	counter += ((const data_t *)aev)->data;
+}
+
+static void proc0()
+{
+	if (aob_wait(aob0) != E_SUCCESS)
+	        tsk_stop();
+}
+
+static void proc1()
+{
+	if (aob_wait(aob1) != E_SUCCESS)
+	        tsk_stop();
+}
+
+// dynamic events allocated from the memory pool are posted to the active objects of higher priority and recycled after handling; duration of aev_alloc and bus_publish
+static void bench_active_object(unsigned n)
+{
+	unsigned long i;
+	bench_t   bench;
+	data_t  * evt;
+	uint32_t  time;
+
+	bench_start(&bench);
+	counter = 0;
+	mem_bind(mem);
+	tsk[0] = wrk_create(2, proc0, 256);          ASSERT(tsk[0]);
+	tsk[1] = wrk_create(2, proc1, 256);          ASSERT(tsk[1]);
+	ASSERT_success(bus_subscribe(bus, aob0, EVT_DATA));
+	if (n > 1)
+	ASSERT_success(bus_subscribe(bus, aob1, EVT_DATA));
+	for (i = 0; i < LOOPS; i++)
+	{
+		time = core_cyc_time();
+		evt = (data_t *)aev_alloc(mem, EVT_DATA);ASSERT(evt);
+		evt->data = 1;
+		bus_publish(bus, &evt->aev);
+		time = core_cyc_time() - time;
+		bench_count(&bench, time);
+	}
+	                                             ASSERT(counter == LOOPS * n);
+	bus_unsubscribe(bus, aob0, EVT_DATA);
+	bus_unsubscribe(bus, aob1, EVT_DATA);
+	aob_reset(aob0);
+	aob_reset(aob1);
+	ASSERT_success(tsk_join(tsk[0]));
+	ASSERT_success(tsk_join(tsk[1]));
+
+	bench_stats(n > 1 ? "active object publish 2" : "active object publish 1", &bench);
+}
+
+void test_bench_active_object()
+{
+	TEST_Notify();
+	tsk_prio(1);
+	bench_active_object(1);
+	bench_active_object(2);
+	tsk_prio(OS_MAIN_PRIO);
+}
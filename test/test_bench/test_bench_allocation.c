@@ -0,0 +1,56 @@
+#include "test.h"
+
+#define LOOPS 10000UL
+#define SIZE 32
+
+// memory block is taken from and given back to the memory pool
+static void bench_memory_pool()
+{
+	unsigned long i;
+	bench_t  bench;
+	mem_t  * mem;
+	void   * blk;
+	uint32_t time;
+
+	bench_start(&bench);
+	mem = mem_create(1, SIZE);                   ASSERT(mem);
+	for (i = 0; i < LOOPS; i++)
+	{
+		time = core_cyc_time();
+		ASSERT_success(mem_take(mem, &blk));
+		mem_give(mem, blk);
+		time = core_cyc_time() - time;
+		bench_count(&bench, time);
+	}
+	mem_delete(mem);
+
+	bench_stats("memory pool take/give", &bench);
+}
+
+// memory segment is allocated on and released to the system heap
+static void bench_malloc()
+{
+	unsigned long i;
+	bench_t  bench;
+	void   * blk;
+	uint32_t time;
+
+	bench_start(&bench);
+	for (i = 0; i < LOOPS; i++)
+	{
+		time = core_cyc_time();
+		blk = malloc(SIZE);                      ASSERT(blk);
+		free(blk);
+		time = core_cyc_time() - time;
+		bench_count(&bench, time);
+	}
+
+	bench_stats("heap malloc/free", &bench);
+}
+
+void test_bench_allocation()
+{
+	TEST_Notify();
+	bench_memory_pool();
+	bench_malloc();
+}
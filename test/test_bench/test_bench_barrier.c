@@ -0,0 +1,57 @@
+#include "test.h"
+
+#define LOOPS 10000UL
+#define TASKS 64
+
+static tsk_t  * tsk[TASKS];
+static bar_t  * bar;
+static char     name[24];
+
+static void proc()
+{
+	if (bar_wait(bar) != E_SUCCESS)
+	        tsk_stop();
+}
+
+// 'n' parties (the current task arrives last) pass through the barrier; duration of bar_wait
+static void bench_barrier(unsigned n)
+{
+	unsigned long i;
+	bench_t  bench;
+	uint32_t time;
+
+	bench_start(&bench);
+	bar = bar_create(n);                         ASSERT(bar);
+	for (i = 0; i < n - 1; i++)
+	{
+		tsk[i] = wrk_create(2, proc, 256);       ASSERT(tsk[i]);
+	}
+	for (i = 0; i < LOOPS; i++)
+	{
+		time = core_cyc_time();
+		ASSERT_success(bar_wait(bar));
+		time = core_cyc_time() - time;
+		bench_count(&bench, time);
+	}
+
+	bar_delete(bar);
+	for (i = 0; i < n - 1; i++)
+	{
+		                                         ASSERT_dead(tsk[i]);
+		tsk_delete(tsk[i]);
+	}
+
+	sprintf(name, "barrier cycle %u", n);
+	bench_stats(name, &bench);
+}
+
+void test_bench_barrier()
+{
+	unsigned n;
+
+	TEST_Notify();
+	tsk_prio(1);
+	for (n = 2; n <= TASKS; n *= 2)
+		bench_barrier(n);
+	tsk_prio(OS_MAIN_PRIO);
+}
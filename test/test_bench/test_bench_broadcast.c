@@ -0,0 +1,59 @@
+#include "test.h"
+
+#define LOOPS 1000UL
+#define TASKS 64
+
+static tsk_t  * tsk[TASKS];
+static evt_t  * evt;
+static char     name[24];
+
+static void proc()
+{
+	unsigned data;
+
+	if (evt_wait(evt, &data) != E_SUCCESS)
+	        tsk_stop();
+}
+
+// current task of higher priority releases 'n' tasks waiting for the event; duration of evt_give
+static void bench_broadcast(unsigned n)
+{
+	unsigned long i;
+	bench_t  bench;
+	uint32_t time;
+
+	bench_start(&bench);
+	evt = evt_create();                          ASSERT(evt);
+	for (i = 0; i < n; i++)
+	{
+		tsk[i] = wrk_create(1 + i % 2, proc, 256); ASSERT(tsk[i]);
+	}
+	for (i = 0; i < LOOPS; i++)
+	{
+		tsk_prio(OS_MAIN_PRIO);                  // let the released tasks wait for the event again
+		tsk_prio(3);
+		time = core_cyc_time();
+		evt_give(evt, (unsigned)i);
+		time = core_cyc_time() - time;
+		bench_count(&bench, time);
+	}
+	tsk_prio(OS_MAIN_PRIO);
+	evt_delete(evt);
+	for (i = 0; i < n; i++)
+	{
+		                                         ASSERT_dead(tsk[i]);
+		tsk_delete(tsk[i]);
+	}
+
+	sprintf(name, "broadcast wakeup %u", n);
+	bench_stats(name, &bench);
+}
+
+void test_bench_broadcast()
+{
+	unsigned n;
+
+	TEST_Notify();
+	for (n = 1; n <= TASKS; n *= 2)
+		bench_broadcast(n);
+}
@@ -0,0 +1,103 @@
+#include "test.h"
+
+#define LOOPS 20000UL
+#define BYTES 4096
+#define LIMIT (BYTES + BYTES / 4 + 3) // odd size: the position of the wrap is moving
+
+static char src[BYTES];
+static char dst[BYTES];
+
+// 'n' bytes are written into and read from the stream buffer
+static void bench_stream(unsigned n)
+{
+	unsigned long i;
+	stm_t  * stm;
+	cnt_t    time;
+
+	stm = stm_create(LIMIT);                     ASSERT(stm);
+	time = sys_time();
+	for (i = 0; i < LOOPS; i++)
+	{
+		ASSERT_success(stm_give(stm, src, n));
+		ASSERT(stm_take(stm, dst, n) == n);
+	}
+	time = sys_time() - time;
+	stm_delete(stm);
+
+	bench_print("stream buffer copy", n, time, LOOPS);
+}
+
+// 'n' bytes are written into and read from the pipe (no critical section)
+static void bench_pipe(unsigned n)
+{
+	unsigned long i;
+	pip_t  * pip;
+	cnt_t    time;
+
+	pip = pip_create(LIMIT);                     ASSERT(pip);
+	time = sys_time();
+	for (i = 0; i < LOOPS; i++)
+	{
+		ASSERT_success(pip_give(pip, src, n));
+		ASSERT(pip_take(pip, dst, n) == n);
+	}
+	time = sys_time() - time;
+	pip_delete(pip);
+
+	bench_print("pipe copy", n, time, LOOPS);
+}
+
+// message of 'n' bytes is written into and read from the message buffer
+static void bench_message(unsigned n)
+{
+	unsigned long i;
+	msg_t  * msg;
+	cnt_t    time;
+
+	msg = msg_create(LIMIT);                     ASSERT(msg);
+	time = sys_time();
+	for (i = 0; i < LOOPS; i++)
+	{
+		ASSERT_success(msg_give(msg, src, n));
+		ASSERT(msg_take(msg, dst, n) == n);
+	}
+	time = sys_time() - time;
+	msg_delete(msg);
+
+	bench_print("message buffer copy", n, time, LOOPS);
+}
+
+// mail of 'n' bytes is written into and read from the mailbox queue
+static void bench_mailbox(unsigned n)
+{
+	unsigned long i;
+	box_t  * box;
+	cnt_t    time;
+
+	box = box_create(4, n);                      ASSERT(box);
+	time = sys_time();
+	for (i = 0; i < LOOPS; i++)
+	{
+		ASSERT_success(box_give(box, src));
+		ASSERT_success(box_take(box, dst));
+	}
+	time = sys_time() - time;
+	box_delete(box);
+
+	bench_print("mailbox queue copy", n, time, LOOPS);
+}
+
+void test_bench_buffers()
+{
+	unsigned n;
+
+	TEST_Notify();
+	for (n = 16; n <= BYTES; n *= 4)
+		bench_stream(n);
+	for (n = 16; n <= BYTES; n *= 4)
+		bench_pipe(n);
+	for (n = 16; n <= BYTES; n *= 4)
+		bench_message(n);
+	for (n = 16; n <= BYTES; n *= 4)
+		bench_mailbox(n);
+}
@@ -0,0 +1,142 @@
+#include "test.h"
+
+#define LOOPS 10000UL
+#define TICKS 200UL
+
+static tsk_t  * tsk[2];
+static sem_t  * sem;
+static lwd_t  * lwd;
+static lwt_t  * lwt[2];
+static bench_t  bench;
+static volatile
+uint32_t        stamp;
+static volatile
+unsigned long   counter;
+
+static void proc_yield()
+{
+	uint32_t time = core_cyc_time() - stamp;
+	if (counter++ > 0)
+	        bench_count(&bench, time);
+	if (counter > LOOPS)
+	        tsk_stop();
+	stamp = core_cyc_time();
+	        tsk_yield();
+}
+
+static void proc_resume()
+{
+	        cur_suspend();
+	        bench_count(&bench, core_cyc_time() - stamp);
+}
+
+static void proc_isr()
+{
+	stamp = core_cyc_time();
+	        sem_giveISR(sem);
+}
+
+static void proc_wait()
+{
+	        ASSERT_success(sem_wait(sem));
+	        bench_count(&bench, core_cyc_time() - stamp);
+	if (++counter >= TICKS)
+	        tsk_stop();
+}
+
+static void proc_lwt( unsigned sigset )
+{
+	uint32_t time = core_cyc_time() - stamp;
+	if (counter++ > 0)
+	        bench_count(&bench, time);
+	if (counter > LOOPS)
+	        return;
+	stamp = core_cyc_time();
+	        lwt_give(lwt[sigset & 1], (sigset & 1) + 1);
+}
+
+static void proc_dispatch()
+{
+	if (lwd_wait(lwd) != E_SUCCESS)
+	        tsk_stop();
+}
+
+// two tasks of the same priority yield control to each other; from tsk_yield in one task to the return from tsk_yield in the other
+static void bench_cooperative()
+{
+	bench_start(&bench);
+	counter = 0;
+	tsk_prio(2);
+	tsk[0] = wrk_create(1, proc_yield, 256);     ASSERT(tsk[0]);
+	tsk[1] = wrk_create(1, proc_yield, 256);     ASSERT(tsk[1]);
+	tsk_prio(OS_MAIN_PRIO);                      ASSERT_dead(tsk[0]);
+	                                             ASSERT_dead(tsk[1]);
+	tsk_delete(tsk[0]);
+	tsk_delete(tsk[1]);
+
+	bench_stats("cooperative switch", &bench);
+}
+
+// task resumes the suspended task of higher priority; from tsk_resume to the running higher priority task
+static void bench_preemptive()
+{
+	unsigned long i;
+
+	bench_start(&bench);
+	tsk_prio(1);
+	tsk[0] = wrk_create(2, proc_resume, 256);    ASSERT(tsk[0]);
+	for (i = 0; i < LOOPS; i++)
+	{
+		stamp = core_cyc_time();
+		tsk_resume(tsk[0]);
+	}
+	tsk_delete(tsk[0]);
+	tsk_prio(OS_MAIN_PRIO);
+
+	bench_stats("preemptive switch", &bench);
+}
+
+// timer callback (in the interrupt handler or in the timer task) releases the task waiting for the semaphore; from sem_giveISR to the return from sem_wait
+static void bench_isr_wakeup()
+{
+	tmr_t  * tmr;
+
+	bench_start(&bench);
+	counter = 0;
+	sem = sem_create(0, semBinary);              ASSERT(sem);
+	tmr = tmr_create(NULL);                      ASSERT(tmr);
+	tsk[0] = wrk_create(2, proc_wait, 256);      ASSERT(tsk[0]);
+	tmr_startFrom(tmr, 1, 1, proc_isr);
+	ASSERT_success(tsk_join(tsk[0]));
+	tmr_delete(tmr);
+	sem_delete(sem);
+
+	bench_stats("isr to task wakeup", &bench);
+}
+
+// two lightweight tasks of the same dispatcher activate each other; from lwt_give in one handler to the start of the other handler
+static void bench_lightweight()
+{
+	bench_start(&bench);
+	counter = 0;
+	lwd = lwd_create();                          ASSERT(lwd);
+	lwt[0] = lwt_create(lwd, proc_lwt);          ASSERT(lwt[0]);
+	lwt[1] = lwt_create(lwd, proc_lwt);          ASSERT(lwt[1]);
+	tsk[0] = wrk_create(2, proc_dispatch, 256);  ASSERT(tsk[0]);
+	lwt_give(lwt[0], 1);                         ASSERT(counter > LOOPS);
+	lwd_delete(lwd);
+	ASSERT_success(tsk_join(tsk[0]));
+	lwt_delete(lwt[0]);
+	lwt_delete(lwt[1]);
+
+	bench_stats("lightweight task switch", &bench);
+}
+
+void test_bench_context_switch()
+{
+	TEST_Notify();
+	bench_cooperative();
+	bench_preemptive();
+	bench_isr_wakeup();
+	bench_lightweight();
+}
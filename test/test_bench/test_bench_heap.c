@@ -0,0 +1,62 @@
+#include "test.h"
+
+#define LOOPS 50000UL
+#define BYTES 256
+#if OS_HEAP_SIZE == 0 || OS_HEAP_SIZE / 4 >= 2048 * BYTES
+#define SLOTS 2048
+#else // the working set takes at most a quarter of the system heap
+#define SLOTS (OS_HEAP_SIZE / 4 / BYTES)
+#endif
+
+static void * buf[SLOTS];
+static size_t len[SLOTS];
+
+// random sequence of allocations (1..BYTES bytes) and releases of up to SLOTS memory segments
+void test_bench_heap()
+{
+	unsigned long i;
+	bench_t  alloc, release;
+	uint32_t time;
+	size_t   live = 0, heap;
+	hst_t    hst;
+	unsigned n;
+
+	TEST_Notify();
+	bench_start(&alloc);
+	bench_start(&release);
+	heap = sys_heapSize();
+	for (i = 0; i < LOOPS; i++)
+	{
+		n = rand() % SLOTS;
+		if (buf[n] == NULL)
+		{
+			len[n] = rand() % BYTES + 1;
+			time = core_cyc_time();
+			buf[n] = malloc(len[n]);             ASSERT(buf[n]);
+			time = core_cyc_time() - time;
+			bench_count(&alloc, time);
+			live += len[n];
+		}
+		else
+		{
+			time = core_cyc_time();
+			free(buf[n]);
+			time = core_cyc_time() - time;
+			bench_count(&release, time);
+			live -= len[n];
+			buf[n] = NULL;
+		}
+	}
+	sys_heapStats(&hst);
+	printf("heap in use: %u bytes requested, %u bytes taken, %u bytes peak\n", (unsigned)live, (unsigned)(heap - hst.size), (unsigned)hst.peak);
+	printf("heap free:   %u bytes in %u segments, largest %u bytes\n", (unsigned)hst.size, hst.free, (unsigned)hst.max);
+	for (n = 0; n < SLOTS; n++)
+	{
+		free(buf[n]);
+		buf[n] = NULL;
+	}
+	                                             ASSERT(heap==sys_heapSize());
+
+	bench_stats("heap malloc", &alloc);
+	bench_stats("heap free", &release);
+}
@@ -0,0 +1,55 @@
+#include "test.h"
+#include <string.h>
+
+#if OS_LOCK_TRACE
+
+#define WORST 8
+
+static cri_t stats[OS_LOCK_TRACE + 1];
+
+static void lock_print(cri_t *cri)
+{
+	const char  * name = cri->file ? strrchr(cri->file, '/') : NULL;
+	unsigned long ns = (unsigned long)((uint64_t)cri->max * 1000000000U / (CYC_FREQUENCY));
+	unsigned i;
+
+	printf("%-24s %4u: %8lu ns max, %8u times, hist:", name ? name + 1 : cri->file ? cri->file : "(lost)", cri->line, ns, cri->count);
+	for (i = 0; i < CRI_BINS; i++)
+		printf(" %u", cri->hist[i]);
+	printf("\n");
+}
+
+// the longest critical sections of the whole test run
+void test_bench_lock_stats()
+{
+	unsigned n, i, j, sum;
+	cri_t    cri;
+
+	TEST_Notify();
+	n = sys_lockStats(stats, OS_LOCK_TRACE + 1); ASSERT(n > 0);
+	for (i = 0; i < n; i++)
+	{
+		for (j = 0, sum = 0; j < CRI_BINS; j++)
+			sum += stats[i].hist[j];
+		ASSERT(sum == stats[i].count);
+	}
+	for (i = 0; i < n && i < WORST; i++)
+	{
+		for (j = i + 1; j < n; j++)
+		{
+			if (stats[j].max > stats[i].max)
+			{
+				cri = stats[i]; stats[i] = stats[j]; stats[j] = cri;
+			}
+		}
+		lock_print(&stats[i]);
+	}
+}
+
+#else
+
+void test_bench_lock_stats()
+{
+}
+
+#endif
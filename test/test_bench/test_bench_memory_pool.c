@@ -0,0 +1,64 @@
+#include "test.h"
+
+#define INITS 20000UL
+#define LOOPS 200UL
+#define SIZE 16
+#if OS_HEAP_SIZE == 0 || OS_HEAP_SIZE / 4 >= 4096 * SIZE
+#define BLOCKS 4096
+#else // the largest memory pool takes at most a quarter of the system heap
+#define BLOCKS (OS_HEAP_SIZE / 4 / SIZE)
+#endif
+
+static void *blk[BLOCKS];
+
+// memory pool of 'n' blocks is created (all blocks are bound to the list of free blocks) and deleted
+static void bench_init(unsigned n)
+{
+	unsigned long i;
+	mem_t  * mem;
+	cnt_t    time;
+
+	time = sys_time();
+	for (i = 0; i < INITS; i++)
+	{
+		mem = mem_create(n, SIZE);               ASSERT(mem);
+		mem_delete(mem);
+	}
+	time = sys_time() - time;
+
+	bench_print("memory pool init", n, time, INITS);
+}
+
+// all 'n' blocks are taken from and given back to the memory pool
+static void bench_give_take(unsigned n)
+{
+	unsigned long i;
+	unsigned j;
+	mem_t  * mem;
+	cnt_t    time;
+
+	mem = mem_create(n, SIZE);                   ASSERT(mem);
+	time = sys_time();
+	for (i = 0; i < LOOPS; i++)
+	{
+		for (j = 0; j < n; j++)
+			ASSERT_success(mem_take(mem, &blk[j]));
+		for (j = 0; j < n; j++)
+			mem_give(mem, blk[j]);
+	}
+	time = sys_time() - time;
+	mem_delete(mem);
+
+	bench_print("memory pool give/take", n, time, LOOPS * n);
+}
+
+void test_bench_memory_pool()
+{
+	unsigned n;
+
+	TEST_Notify();
+	for (n = 16; n <= BLOCKS; n *= 4)
+		bench_init(n);
+	for (n = 16; n <= BLOCKS; n *= 4)
+		bench_give_take(n);
+}
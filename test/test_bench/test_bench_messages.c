@@ -0,0 +1,173 @@
+#include "test.h"
+
+#define LOOPS 10000UL
+
+static tsk_t  * tsk;
+static box_t  * box;
+static evq_t  * evq;
+static msg_t  * msg;
+static stm_t  * stm;
+static mtx_t  * mtx;
+static bench_t  bench;
+static volatile
+uint32_t        stamp;
+
+static void proc_box()
+{
+	unsigned data;
+
+	if (box_wait(box, &data) == E_SUCCESS)
+	        bench_count(&bench, core_cyc_time() - stamp);
+	else
+	        tsk_stop();
+}
+
+static void proc_evq()
+{
+	unsigned data;
+
+	if (evq_wait(evq, &data) == E_SUCCESS)
+	        bench_count(&bench, core_cyc_time() - stamp);
+	else
+	        tsk_stop();
+}
+
+static void proc_msg()
+{
+	unsigned data;
+
+	if (msg_wait(msg, &data, sizeof(data)) == sizeof(data))
+	        bench_count(&bench, core_cyc_time() - stamp);
+	else
+	        tsk_stop();
+}
+
+static void proc_stm()
+{
+	unsigned data;
+
+	if (stm_wait(stm, &data, sizeof(data)) == sizeof(data))
+	        bench_count(&bench, core_cyc_time() - stamp);
+	else
+	        tsk_stop();
+}
+
+static void proc_mtx()
+{
+	        cur_suspend();
+	        ASSERT_success(mtx_lock(mtx));
+	        bench_count(&bench, core_cyc_time() - stamp);
+	        ASSERT_success(mtx_unlock(mtx));
+}
+
+// task sends messages to the waiting receiver of higher priority; from the send function to the return from the receive function
+static void bench_mailbox_queue()
+{
+	unsigned long i;
+	unsigned data;
+
+	bench_start(&bench);
+	box = box_create(1, sizeof(unsigned));       ASSERT(box);
+	tsk = wrk_create(2, proc_box, 256);          ASSERT(tsk);
+	for (i = 0; i < LOOPS; i++)
+	{
+		data = (unsigned)i;
+		stamp = core_cyc_time();
+		ASSERT_success(box_give(box, &data));
+	}
+	box_delete(box);                             ASSERT_dead(tsk);
+	tsk_delete(tsk);
+
+	bench_stats("mailbox queue transfer", &bench);
+}
+
+static void bench_event_queue()
+{
+	unsigned long i;
+
+	bench_start(&bench);
+	evq = evq_create(1);                         ASSERT(evq);
+	tsk = wrk_create(2, proc_evq, 256);          ASSERT(tsk);
+	for (i = 0; i < LOOPS; i++)
+	{
+		stamp = core_cyc_time();
+		ASSERT_success(evq_give(evq, (unsigned)i));
+	}
+	evq_delete(evq);                             ASSERT_dead(tsk);
+	tsk_delete(tsk);
+
+	bench_stats("event queue transfer", &bench);
+}
+
+static void bench_message_buffer()
+{
+	unsigned long i;
+	unsigned data;
+
+	bench_start(&bench);
+	msg = msg_create(sizeof(unsigned) * 4);      ASSERT(msg);
+	tsk = wrk_create(2, proc_msg, 256);          ASSERT(tsk);
+	for (i = 0; i < LOOPS; i++)
+	{
+		data = (unsigned)i;
+		stamp = core_cyc_time();
+		ASSERT_success(msg_give(msg, &data, sizeof(data)));
+	}
+	msg_delete(msg);                             ASSERT_dead(tsk);
+	tsk_delete(tsk);
+
+	bench_stats("message buffer transfer", &bench);
+}
+
+static void bench_stream_buffer()
+{
+	unsigned long i;
+	unsigned data;
+
+	bench_start(&bench);
+	stm = stm_create(sizeof(unsigned) * 4);      ASSERT(stm);
+	tsk = wrk_create(2, proc_stm, 256);          ASSERT(tsk);
+	for (i = 0; i < LOOPS; i++)
+	{
+		data = (unsigned)i;
+		stamp = core_cyc_time();
+		ASSERT_success(stm_give(stm, &data, sizeof(data)));
+	}
+	stm_delete(stm);                             ASSERT_dead(tsk);
+	tsk_delete(tsk);
+
+	bench_stats("stream buffer transfer", &bench);
+}
+
+// mutex is handed over to the waiting task of higher priority; from mtx_unlock to the return from mtx_lock
+static void bench_mutex()
+{
+	unsigned long i;
+
+	bench_start(&bench);
+	mtx = mtx_create(mtxDefault, 0);             ASSERT(mtx);
+	tsk = wrk_create(2, proc_mtx, 256);          ASSERT(tsk);
+	for (i = 0; i < LOOPS; i++)
+	{
+		ASSERT_success(mtx_lock(mtx));
+		tsk_resume(tsk);
+		stamp = core_cyc_time();
+		ASSERT_success(mtx_unlock(mtx));
+	}
+	tsk_delete(tsk);
+	mtx_delete(mtx);
+
+	bench_stats("mutex ping-pong", &bench);
+}
+
+void test_bench_messages()
+{
+	TEST_Notify();
+	tsk_prio(1);
+	bench_mailbox_queue();
+	bench_event_queue();
+	bench_message_buffer();
+	bench_stream_buffer();
+	bench_mutex();
+	tsk_prio(OS_MAIN_PRIO);
+}
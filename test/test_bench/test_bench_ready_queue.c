@@ -0,0 +1,84 @@
+#include "test.h"
+
+#define LOOPS 100000UL
+#if OS_HEAP_SIZE == 0 || OS_HEAP_SIZE / 1024 >= 64
+#define TASKS 64
+#else // each worker (control block and stack) is given at most 1 KB of the system heap
+#define TASKS (OS_HEAP_SIZE / 1024)
+#endif
+#define PRIOS 16
+
+static tsk_t  * tsk[TASKS];
+static volatile
+unsigned long   counter;
+
+static void proc_idle()
+{
+	        tsk_stop();
+}
+
+static void proc_ring()
+{
+	        counter++;
+	        tsk_yield();
+}
+
+// 'n' ready tasks of higher priorities precede the task being inserted into the READY queue
+static void bench_insert(unsigned n)
+{
+	unsigned long i;
+	tsk_t  * low;
+	cnt_t    time;
+
+	low = wrk_create(1, proc_idle, 256);         ASSERT(low);
+	for (i = 0; i < n; i++)
+	{
+		tsk[i] = wrk_create(2 + i % PRIOS, proc_idle, 256); ASSERT(tsk[i]);
+	}
+
+	time = sys_time();
+	for (i = 0; i < LOOPS; i++)
+	{
+		tsk_suspend(low);
+		tsk_resume(low);
+	}
+	time = sys_time() - time;
+
+	for (i = 0; i < n; i++)
+		tsk_delete(tsk[i]);
+	tsk_delete(low);
+
+	bench_print("ready queue insert", n, time, LOOPS);
+}
+
+// 'n' ready tasks of the same priority yield control to each other
+static void bench_switch(unsigned n)
+{
+	unsigned i;
+
+	for (i = 0; i < n; i++)
+	{
+		tsk[i] = wrk_create(1, proc_ring, 256);  ASSERT(tsk[i]);
+	}
+
+	counter = 0;
+	tsk_sleepFor(SEC/4);
+
+	for (i = 0; i < n; i++)
+		tsk_delete(tsk[i]);
+
+	bench_print("ready queue switch", n, SEC/4, counter);
+}
+
+void test_bench_ready_queue()
+{
+	unsigned n;
+
+	TEST_Notify();
+	tsk_prio(PRIOS + 2);
+	for (n = 1; n <= TASKS; n *= 2)
+		bench_insert(n);
+	for (n = 1; n <= TASKS; n *= 2)
+		bench_switch(n);
+	tsk_prio(OS_MAIN_PRIO);
+}
@@ -0,0 +1,134 @@
+#include "test.h"
+
+#define LOOPS 200000UL
+
+enum { S0, S1, S11, S12, S2, STATES };
+enum { SIG_A, SIG_B, SIG_C, SIG_D, SIG_E, SIGNALS };
+
+struct Context
+{
+	volatile
+	unsigned long counter;
+};
+
+static void action( Context &ctx )                 { ctx.counter++; }
+static void effect( Context &ctx, const aev_t * )  { ctx.counter++; }
+
+static constexpr HsmState<Context> states[] =
+{
+	{ hsmNone, S1,      action, action },
+	{ S0,      S11,     action, action },
+	{ S1,      hsmNone, action, action },
+	{ S1,      hsmNone, action, action },
+	{ S0,      hsmNone, action, action },
+};
+
+static constexpr HsmTransition<Context> transitions[] =
+{
+	{ S11, SIG_A, S12 },
+	{ S1,  SIG_B, S2  },
+	{ S2,  SIG_C, S1  },
+	{ S0,  SIG_D, hsmNone, effect },
+	{ S1,  SIG_E, S1  },
+};
+
+static constexpr auto table = HsmTable<SIGNALS>(states, transitions, S0);
+
+// the sequence of signals returning to the initial state: A, B, D, C, E
+static const unsigned sequence[] = { SIG_A, SIG_B, SIG_D, SIG_C, SIG_E };
+static const unsigned length = sizeof(sequence) / sizeof(*sequence);
+
+static Context ctx;
+
+// the same state machine implemented with nested switch statements (for reference)
+static unsigned sw_state;
+
+static void sw_dispatch( Context &c, unsigned signal )
+{
+	switch (sw_state)
+	{
+	case S11:
+		switch (signal)
+		{
+		case SIG_A: action(c); action(c); sw_state = S12; return;
+		}
+		// fall through
+	case S12:
+		switch (signal)
+		{
+		case SIG_B: action(c); action(c); action(c); sw_state = S2; return;
+		case SIG_E: action(c); action(c); action(c); action(c); sw_state = S11; return;
+		}
+		break;
+	case S2:
+		switch (signal)
+		{
+		case SIG_C: action(c); action(c); action(c); sw_state = S11; return;
+		}
+		break;
+	}
+
+	switch (signal)
+	{
+	case SIG_D: effect(c, nullptr); return;
+	}
+}
+
+// events of the signals given in sequence are dispatched to the hierarchical state machine (transition table); duration of the whole sequence
+static void bench_table()
+{
+	StateMachineT<decltype(table)> hsm(table, ctx);
+	unsigned long i;
+	unsigned j;
+	bench_t  bench;
+	uint32_t time;
+
+	bench_start(&bench);
+	hsm.start();
+	ctx.counter = 0;
+	for (i = 0; i < LOOPS; i++)
+	{
+		time = core_cyc_time();
+		for (j = 0; j < length; j++)
+			hsm.dispatch(sequence[j]);
+		time = core_cyc_time() - time;
+		bench_count(&bench, time);
+	}
+	                                             ASSERT(hsm.state() == S11);
+	                                             ASSERT(ctx.counter == LOOPS * 13);
+
+	bench_stats("hsm table sequence", &bench);
+}
+
+// events of the signals given in sequence are dispatched to the state machine implemented with nested switch statements; duration of the whole sequence
+static void bench_switch()
+{
+	unsigned long i;
+	unsigned j;
+	bench_t  bench;
+	uint32_t time;
+
+	bench_start(&bench);
+	ctx.counter = 0;
+	sw_state = S11;
+	for (i = 0; i < LOOPS; i++)
+	{
+		time = core_cyc_time();
+		for (j = 0; j < length; j++)
+			sw_dispatch(ctx, sequence[j]);
+		time = core_cyc_time() - time;
+		bench_count(&bench, time);
+	}
+	                                             ASSERT(sw_state == S11);
+	                                             ASSERT(ctx.counter == LOOPS * 13);
+
+	bench_stats("hsm switch sequence", &bench);
+}
+
+extern "C"
+void test_bench_state_machine()
+{
+	TEST_Notify();
+	bench_table();
+	bench_switch();
+}
@@ -0,0 +1,38 @@
+#include "test.h"
+
+#define LOOPS 100000UL
+#define TIMERS 256
+
+static tmr_t tmr[TIMERS + 1];
+
+// 'n' active timers precede the timer being inserted into the timers queue
+static void bench_insert(unsigned n)
+{
+	unsigned long i;
+	cnt_t    time;
+
+	for (i = 0; i < n; i++)
+		tmr_start(&tmr[i], SEC + i * 7, 0);
+
+	time = sys_time();
+	for (i = 0; i < LOOPS; i++)
+	{
+		tmr_start(&tmr[TIMERS], SEC + n * 7, 0);
+		tmr_stop(&tmr[TIMERS]);
+	}
+	time = sys_time() - time;
+
+	for (i = 0; i < n; i++)
+		tmr_stop(&tmr[i]);
+
+	bench_print("timers queue insert", n, time, LOOPS);
+}
+
+void test_bench_timer_queue()
+{
+	unsigned n;
+
+	TEST_Notify();
+	for (n = 1; n <= TIMERS; n *= 2)
+		bench_insert(n);
+}
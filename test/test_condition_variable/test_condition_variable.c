@@ -8,4 +8,6 @@ void test_condition_variable()
 	TEST_Add(test_condition_variable_2);
 	TEST_Add(test_condition_variable_3);
 #endif
+	TEST_Add(test_condition_variable_4);
+	TEST_Add(test_condition_variable_5);
 }
@@ -0,0 +1,59 @@
+#include "test.h"
+
+#define TASKS 8
+
+static tsk_t * tsk[TASKS];
+static mtx_t * mtx;
+static cnd_t * cnd;
+static int     counter;
+
+static void proc()
+{
+	unsigned event;
+
+	event = mtx_wait(mtx);                       ASSERT_success(event);
+	event = cnd_wait(cnd, mtx);                  ASSERT_success(event);
+	        counter++;
+	event = mtx_give(mtx);                       ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+	int      i;
+
+	        counter = 0;
+	        tsk_prio(1);
+	for (i = 0; i < TASKS; i++)
+	{
+		tsk[i] = wrk_create(2, proc, 256);       ASSERT(tsk[i]);
+		                                         ASSERT(tsk[i]->guard == &cnd->obj.queue);
+	}
+	event = mtx_wait(mtx);                       ASSERT_success(event);
+	        cnd_give(cnd, cndAll);               ASSERT(tsk_this()->prio == 2);
+	for (i = 0; i < TASKS; i++)
+	{
+		                                         ASSERT(tsk[i]->guard == &mtx->obj.queue);
+	}
+	                                             ASSERT(counter == 0);
+	event = mtx_give(mtx);                       ASSERT_success(event);
+	                                             ASSERT(tsk_this()->prio == 1);
+	                                             ASSERT(counter == TASKS);
+	for (i = 0; i < TASKS; i++)
+	{
+		                                         ASSERT_dead(tsk[i]);
+		tsk_delete(tsk[i]);
+	}
+	        tsk_prio(OS_MAIN_PRIO);
+}
+
+void test_condition_variable_4()
+{
+	TEST_Notify();
+	mtx = mtx_create(mtxPrioInherit, 0);         ASSERT(mtx);
+	cnd = cnd_create();                          ASSERT(cnd);
+	TEST_Call();
+	cnd_delete(cnd);
+	mtx_delete(mtx);
+}
@@ -0,0 +1,10 @@
+#include "test.h"
+
+void test_coroutine()
+{
+	UNIT_Notify();
+#ifndef __CSMC__
+	TEST_Add(test_coroutine_1);
+	TEST_Add(test_coroutine_2);
+#endif
+}
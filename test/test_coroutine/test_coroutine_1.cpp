@@ -0,0 +1,64 @@
+#include "test.h"
+
+#if (__cplusplus >= 202002) && defined(__cpp_impl_coroutine)
+
+#include <oscoro.h>
+#include <string.h>
+
+static char     trace[8];
+static unsigned pos;
+
+static Coroutine proc( char c, unsigned n )
+{
+	while (n--)
+	{
+	        trace[pos++] = c;
+	        co_await ThisCoroutine::yield();
+	}
+}
+
+static Coroutine sleeper( baseExecutor &exe )
+{
+	unsigned event;
+	cnt_t    start;
+	bool     result;
+
+	        start = sys_time();
+	event = co_await ThisCoroutine::sleepFor(1); ASSERT_timeout(event);
+	                                             ASSERT(sys_time() - start >= 1);
+	// the coroutine spawned by the coroutine of the executor
+	result = exe.spawn(proc('C', 1));            ASSERT(result);
+}
+
+static void test()
+{
+	ExecutorT<1> exe;
+	bool     result;
+
+	        pos = 0;
+	result = exe.spawn(proc('A', 2));            ASSERT(result);
+	result = exe.spawn(proc('B', 2));            ASSERT(result);
+	                                             ASSERT(exe.alive() == 2);
+	// the ready coroutines are resumed in turn
+	        exe.run();                           ASSERT(exe.alive() == 0);
+	                                             ASSERT(pos == 4 && memcmp(trace, "ABAB", 4) == 0);
+	result = exe.spawn(sleeper(exe));            ASSERT(result);
+	        exe.run();                           ASSERT(exe.alive() == 0);
+	                                             ASSERT(pos == 5 && trace[4] == 'C');
+}
+
+extern "C"
+void test_coroutine_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
+
+#else
+
+extern "C"
+void test_coroutine_1()
+{
+}
+
+#endif
@@ -0,0 +1,93 @@
+#include "test.h"
+
+#if (__cplusplus >= 202002) && defined(__cpp_impl_coroutine)
+
+#include <oscoro.h>
+
+static unsigned counter;
+
+static void proc()
+{
+	unsigned event;
+
+	        tsk_sleepFor(MSEC);
+	event = evq_give(evq1, 3);                   ASSERT_success(event);
+	        tsk_stop();
+}
+
+static Coroutine giver()
+{
+	unsigned event;
+	unsigned data = 1;
+
+	event = sem_give(sem1);                      ASSERT_success(event);
+	event = box_give(box1, &data);               ASSERT_success(event);
+	event = evq_give(evq1, 2);                   ASSERT_success(event);
+	        flg_give(flg1, 4);
+	        co_return;
+}
+
+static Coroutine waiter( baseExecutor &exe )
+{
+	unsigned event;
+	unsigned data;
+	cnt_t    start;
+	bool     result;
+
+	result = exe.spawn(giver());                 ASSERT(result);
+	// the coroutine is resumed when the object has been given by the other coroutine
+	event = co_await ThisCoroutine::waitFor(*sem1, 2 * MSEC);
+	                                             ASSERT_success(event);
+	// the objects are available, the coroutine is not suspended
+	event = co_await ThisCoroutine::waitFor(*box1, &data, 2 * MSEC);
+	                                             ASSERT_success(event);
+	                                             ASSERT(data == 1);
+	event = co_await ThisCoroutine::waitFor(*evq1, &data, 2 * MSEC);
+	                                             ASSERT_success(event);
+	                                             ASSERT(data == 2);
+	event = co_await ThisCoroutine::waitFor(*flg1, 4, 2 * MSEC);
+	                                             ASSERT_success(event);
+	// the coroutine is resumed when the timeout has expired
+	        start = sys_time();
+	event = co_await ThisCoroutine::waitFor(*sem1, MSEC);
+	                                             ASSERT_timeout(event);
+	                                             ASSERT(sys_time() - start >= MSEC);
+	event = co_await ThisCoroutine::waitFor(*box1, &data, IMMEDIATE);
+	                                             ASSERT_timeout(event);
+	// the executor is released by the task giving the object
+	                                             ASSERT_dead(tsk2);
+	        tsk_startFrom(tsk2, proc);
+	event = co_await ThisCoroutine::waitFor(*evq1, &data, INFINITE);
+	                                             ASSERT_success(event);
+	                                             ASSERT(data == 3);
+	        counter++;
+}
+
+static void test()
+{
+	ExecutorT<2> exe;
+	unsigned event;
+	bool     result;
+
+	        counter = 0;
+	result = exe.spawn(waiter(exe));             ASSERT(result);
+	        exe.run();                           ASSERT(exe.alive() == 0);
+	                                             ASSERT(counter == 1);
+	event = tsk_join(tsk2);                      ASSERT_success(event);
+}
+
+extern "C"
+void test_coroutine_2()
+{
+	TEST_Notify();
+	TEST_Call();
+}
+
+#else
+
+extern "C"
+void test_coroutine_2()
+{
+}
+
+#endif
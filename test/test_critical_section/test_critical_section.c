@@ -0,0 +1,9 @@
+#include "test.h"
+
+void test_critical_section()
+{
+	UNIT_Notify();
+#if OS_LOCK_TRACE
+	TEST_Add(test_critical_section_1);
+#endif
+}
@@ -0,0 +1,93 @@
+#include "test.h"
+#include <string.h>
+
+#if OS_LOCK_TRACE
+
+#define LOOPS 10
+
+static cri_t    stats[OS_LOCK_TRACE + 1];
+static unsigned line1;
+static unsigned line2;
+static uint32_t time2;
+
+static void lock1()                              // empty critical section
+{
+	sys_lock(); line1 = __LINE__;
+	{
+	}
+	sys_unlock();
+}
+
+static void lock2()                              // critical section of measurable duration
+{
+	volatile unsigned i;
+	uint32_t start;
+
+	sys_lock(); line2 = __LINE__;
+	{
+		start = core_cyc_time();
+		for (i = 0; i < 1000; i++);
+		time2 = core_cyc_time() - start;
+	}
+	sys_unlock();
+}
+
+static cri_t get(unsigned line)                  // statistics of the critical section at 'line' of this file
+{
+	cri_t    cri = { 0 };
+	unsigned n, i;
+
+	n = sys_lockStats(stats, OS_LOCK_TRACE + 1);
+	for (i = 0; i < n; i++)
+		if (stats[i].file && stats[i].line == line && strcmp(stats[i].file, __FILE__) == 0)
+			cri = stats[i];
+	return cri;
+}
+
+static void check(cri_t *cri)                    // the histogram is consistent with the count and the longest interval
+{
+	unsigned i, sum = 0, bin = 0;
+	uint32_t max = cri->max;
+
+	for (i = 0; i < CRI_BINS; i++)
+		sum += cri->hist[i];
+	                                             ASSERT(sum == cri->count);
+	for (max >>= 6; max && bin < CRI_BINS - 1; max >>= 1)
+		bin++;
+	                                             ASSERT(cri->hist[bin] > 0);
+	for (i = bin + 1; i < CRI_BINS; i++)
+		                                         ASSERT(cri->hist[i] == 0);
+}
+
+static void test()
+{
+	cri_t    old1, old2, cri;
+	unsigned i, n;
+
+	        lock1();
+	        lock2();
+	old1 = get(line1);                           ASSERT(old1.count > 0);
+	old2 = get(line2);                           ASSERT(old2.count > 0);
+	for (i = 0; i < LOOPS; i++)
+	{
+		lock1();
+	}
+	        lock2();
+	cri  = get(line1);                           ASSERT(cri.count == old1.count + LOOPS);
+	                                             ASSERT(cri.max >= old1.max);
+	        check(&cri);
+	cri  = get(line2);                           ASSERT(cri.count == old2.count + 1);
+	                                             ASSERT(cri.max >= old2.max);
+	                                             ASSERT(cri.max >= time2);
+	        check(&cri);
+	n = sys_lockStats(stats, 1);                 ASSERT(n == 1);
+	n = sys_lockStats(NULL, 0);                  ASSERT(n == 0);
+}
+
+void test_critical_section_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
+
+#endif
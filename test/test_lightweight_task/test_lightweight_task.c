@@ -0,0 +1,12 @@
+#include "test.h"
+
+void test_lightweight_task()
+{
+	UNIT_Notify();
+	TEST_Add(test_lightweight_task_1);
+#ifndef __CSMC__
+	TEST_Add(test_lightweight_task_2);
+#endif
+	TEST_Add(test_lightweight_task_3);
+	TEST_Add(test_lightweight_task_4);
+}
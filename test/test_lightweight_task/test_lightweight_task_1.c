@@ -0,0 +1,84 @@
+#include "test.h"
+
+static void procA( unsigned );
+static void procB( unsigned );
+
+static_LWD(lwd3);
+static_LWT(lwtA, lwd3, procA);
+static_LWT(lwtB, lwd3, procB);
+
+static unsigned sigA, sigB;
+static unsigned counter;
+static bool     released;
+
+static void procA( unsigned sigset )
+{
+	        sigA = sigset;
+	        counter++;
+	        if (sigset & 1)
+	        lwt_give(lwtB, 4);
+	        if (sigset & 2)
+	        released = tsk2->guard == NULL;
+}
+
+static void procB( unsigned sigset )
+{
+	        sigB = sigset;
+	        counter++;
+}
+
+static void dispatch()
+{
+	unsigned event;
+
+	event = lwd_wait(lwd3);
+	if (event != E_SUCCESS)
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+
+	        counter = 0;
+		                                         ASSERT_dead(tsk2);
+	        tsk_startFrom(tsk2, dispatch);       ASSERT(tsk2->guard == &lwd3->obj.queue);
+	// the lightweight task activated from its handler is dispatched without any context switch
+	        lwt_give(lwtA, 1);                   ASSERT(counter == 2);
+	                                             ASSERT(sigA == 1 && sigB == 4);
+	// activations of the pending lightweight task are merged
+	        tsk_prio(3);
+	        lwt_give(lwtA, 2);
+	        lwt_give(lwtA, 8);                   ASSERT(counter == 2);
+	        tsk_prio(0);                         ASSERT(counter == 3);
+	                                             ASSERT(sigA == 10);
+	// a waiting task is released for every pending lightweight task
+	                                             ASSERT_dead(tsk3);
+	        tsk_startFrom(tsk3, dispatch);       ASSERT(tsk3->guard == &lwd3->obj.queue);
+	        tsk_prio(4);
+	        released = false;
+	        lwt_give(lwtA, 2);                   ASSERT(tsk3->guard == NULL);
+	        lwt_give(lwtB, 2);                   ASSERT(tsk2->guard == &lwd3->obj.queue);
+	        tsk_prio(0);                         ASSERT(counter == 5);
+	                                             ASSERT(sigA == 2 && sigB == 2);
+	                                             ASSERT(released);
+	        lwd_reset(lwd3);
+	event = tsk_join(tsk2);                      ASSERT_success(event);
+	event = tsk_join(tsk3);                      ASSERT_success(event);
+	// the pending lightweight task can be dispatched by any task
+	        lwt_give(lwtB, 1);
+	event = lwd_take(lwd3);                      ASSERT_success(event);
+	                                             ASSERT(counter == 6 && sigB == 1);
+	event = lwd_take(lwd3);                      ASSERT_timeout(event);
+	// reset of the dispatcher discards the pending lightweight tasks
+	        lwt_give(lwtB, 1);
+	        lwd_reset(lwd3);                     ASSERT(lwtB->sigset == 0);
+	event = lwd_take(lwd3);                      ASSERT_timeout(event);
+	                                             ASSERT(counter == 6);
+}
+
+void test_lightweight_task_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
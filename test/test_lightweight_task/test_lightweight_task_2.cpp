@@ -0,0 +1,46 @@
+#include "test.h"
+
+static LightweightDispatcher lwd3;
+
+static unsigned sent;
+static unsigned received;
+
+static LightweightTask lwt3(lwd3, [](unsigned sigset){ received = sigset; });
+static LightweightTask lwt4(lwd3, [](unsigned sigset){ received = ~sigset; });
+
+static void dispatch()
+{
+	unsigned event;
+
+	event = lwd3.wait();
+	if (event != E_SUCCESS)
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+
+		                                         ASSERT_dead(tsk2);
+	        tsk_startFrom(tsk2, dispatch);
+	        sent = (unsigned)rand() | 1;
+	        lwt3.give(sent);                     ASSERT(received == sent);
+	event = lwd3.waitFor(1);                     ASSERT_timeout(event);
+	auto lwt = LightweightTask::Create(lwd3, [](unsigned sigset){ received = sigset + 1; });
+	                                             ASSERT(lwt);
+	        lwt->give(sent);                     ASSERT(received == sent + 1);
+	// the destroyed lightweight task is removed from the dispatcher
+	        tsk_prio(3);
+	        lwt4.give(sent);
+	        lwt4.destroy();                      ASSERT(received == sent + 1);
+	        tsk_prio(0);                         ASSERT(received == sent + 1);
+	        lwd3.kill();
+	event = tsk_join(tsk2);                      ASSERT_success(event);
+}
+
+extern "C"
+void test_lightweight_task_2()
+{
+	TEST_Notify();
+	TEST_Call();
+}
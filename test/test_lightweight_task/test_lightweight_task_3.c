@@ -0,0 +1,60 @@
+#include "test.h"
+
+static void procC( unsigned );
+
+static_LWD(lwd3);
+static_LWT(lwtC, lwd3, procC);
+
+static unsigned sigC;
+static unsigned depth;
+static unsigned counter;
+
+static void dispatch()
+{
+	unsigned event;
+
+	event = lwd_wait(lwd3);
+	if (event != E_SUCCESS)
+	        tsk_stop();
+}
+
+static void procC( unsigned sigset )
+{
+	                                             ASSERT(depth == 0);
+	        depth++;
+	        sigC |= sigset;
+	        counter++;
+	        if (sigset & 1)
+	        {
+	// the second dispatcher task of higher priority is waiting for the dispatcher
+	        tsk_startFrom(tsk3, dispatch);       ASSERT(tsk3->guard == &lwd3->obj.queue);
+	// the lightweight task activated during its execution is not executed by the other task
+	        lwt_give(lwtC, 2);                   ASSERT(counter == 1);
+	                                             ASSERT(tsk3->guard == &lwd3->obj.queue);
+	        }
+	        depth--;
+}
+
+static void test()
+{
+	unsigned event;
+
+	        sigC = 0;
+	        counter = 0;
+	                                             ASSERT_dead(tsk2);
+	                                             ASSERT_dead(tsk3);
+	        tsk_startFrom(tsk2, dispatch);       ASSERT(tsk2->guard == &lwd3->obj.queue);
+	// the lightweight task activated during its execution is dispatched after its completion
+	        lwt_give(lwtC, 1);                   ASSERT(counter == 2);
+	                                             ASSERT(sigC == 3);
+	                                             ASSERT(lwtC->busy == false);
+	        lwd_reset(lwd3);
+	event = tsk_join(tsk2);                      ASSERT_success(event);
+	event = tsk_join(tsk3);                      ASSERT_success(event);
+}
+
+void test_lightweight_task_3()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,43 @@
+#include "test.h"
+
+static lwt_t *lwt4;
+static unsigned counter;
+
+static void proc( unsigned sigset )
+{
+	        counter++;
+	        if (sigset & 1)
+	        {
+	// the lightweight task destroyed during its execution is freed after its completion
+	        lwt_destroy(lwt4);                   ASSERT(lwt4->lwd == NULL);
+	// and its further activations are ignored
+	        lwt_give(lwt4, 2);                   ASSERT(lwt4->sigset == 0);
+	        }
+}
+
+static void test()
+{
+	lwd_t *lwd;
+	unsigned event;
+
+	        counter = 0;
+	        lwd = lwd_create();                  ASSERT(lwd);
+	        lwt4 = lwt_create(lwd, proc);        ASSERT(lwt4);
+	        lwt_give(lwt4, 1);
+	event = lwd_take(lwd);                       ASSERT_success(event);
+	                                             ASSERT(counter == 1);
+	event = lwd_take(lwd);                       ASSERT_timeout(event);
+	        lwt4 = lwt_create(lwd, proc);        ASSERT(lwt4);
+	        lwt_give(lwt4, 2);                   ASSERT(lwd->head == lwt4);
+	// the lightweight task pending on the destroyed dispatcher loses it
+	        lwd_destroy(lwd);                    ASSERT(lwt4->lwd == NULL);
+	// and its further activations are ignored
+	        lwt_give(lwt4, 2);                   ASSERT(lwt4->sigset == 0);
+	        lwt_destroy(lwt4);                   ASSERT(counter == 1);
+}
+
+void test_lightweight_task_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,8 @@
+#include "test.h"
+
+void test_pipe()
+{
+	UNIT_Notify();
+	TEST_Add(test_pipe_1);
+	TEST_Add(test_pipe_2);
+}
@@ -0,0 +1,68 @@
+#include "test.h"
+
+#define SIZE sizeof(unsigned)
+
+static_PIP(pip0, SIZE);
+static_PIP(pip1, SIZE);
+static_PIP(pip2, SIZE);
+static_PIP(pip3, SIZE);
+
+static unsigned sent;
+
+static void proc2()
+{
+	unsigned bytes;
+	unsigned event;
+
+ 	bytes = pip_wait(pip2, &event, SIZE);        ASSERT(bytes == SIZE);
+	                                             ASSERT(event == sent);
+	event = pip_give(pip3, &event, SIZE);        ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void proc1()
+{
+	unsigned bytes;
+	unsigned event;
+		                                         ASSERT_dead(tsk2);
+	        tsk_startFrom(tsk2, proc2);          ASSERT_ready(tsk2);
+ 	bytes = pip_wait(pip1, &event, SIZE);        ASSERT(bytes == SIZE);
+ 	                                             ASSERT(event == sent);
+	event = pip_give(pip2, &event, SIZE);        ASSERT_success(event);
+	event = tsk_join(tsk2);                      ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void proc0()
+{
+	unsigned bytes;
+	unsigned event;
+		                                         ASSERT_dead(tsk1);
+	        tsk_startFrom(tsk1, proc1);          ASSERT_ready(tsk1);
+ 	bytes = pip_wait(pip0, &event, SIZE);        ASSERT(bytes == SIZE);
+ 	                                             ASSERT(event == sent);
+	event = pip_give(pip1, &event, SIZE);        ASSERT_success(event);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned bytes;
+	unsigned event;
+		                                         ASSERT_dead(&tsk0);
+	        tsk_startFrom(&tsk0, proc0);         ASSERT_ready(&tsk0);
+	        tsk_yield();
+	        tsk_yield();
+	        sent = rand();
+	event = pip_give(pip0, &sent, SIZE);         ASSERT_success(event);
+ 	bytes = pip_wait(pip3, &event, SIZE);        ASSERT(bytes == SIZE);
+ 	                                             ASSERT(event == sent);
+	event = tsk_join(&tsk0);                     ASSERT_success(event);
+}
+
+void test_pipe_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
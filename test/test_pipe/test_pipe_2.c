@@ -0,0 +1,57 @@
+#include "test.h"
+
+#define SIZE sizeof(unsigned)
+
+static_PIP(pip4, 3 * SIZE);
+
+static unsigned sent;
+
+static void isr()
+{
+	unsigned event;
+
+	event = pip_giveISR(pip4, &sent, SIZE);      ASSERT_success(event);
+}
+
+static void wait()
+{
+	unsigned bytes;
+	unsigned event;
+
+	        sent = rand();
+	        tmr_startFrom(&tmr0, 1, 0, isr);
+ 	bytes = pip_wait(pip4, &event, SIZE);        ASSERT(bytes == SIZE);
+ 	                                             ASSERT(event == sent);
+	event = tmr_wait(&tmr0);                     ASSERT_success(event);
+}
+
+static void test()
+{
+	unsigned bytes;
+	unsigned event;
+
+	        wait();
+	        wait();
+	        wait();
+	        wait();
+	        wait();
+	event = pip_give(pip4, &sent, 4 * SIZE);     ASSERT_failure(event);
+	event = pip_give(pip4, &sent, SIZE);         ASSERT_success(event);
+	event = pip_give(pip4, &sent, SIZE);         ASSERT_success(event);
+	event = pip_give(pip4, &sent, SIZE);         ASSERT_success(event);
+	event = pip_give(pip4, &sent, SIZE);         ASSERT_timeout(event);
+	                                             ASSERT(pip_count(pip4) == 3 * SIZE);
+	                                             ASSERT(pip_space(pip4) == 0);
+ 	bytes = pip_take(pip4, &event, SIZE);        ASSERT(bytes == SIZE);
+ 	bytes = pip_take(pip4, &event, SIZE);        ASSERT(bytes == SIZE);
+ 	bytes = pip_take(pip4, &event, SIZE);        ASSERT(bytes == SIZE);
+	                                             ASSERT(event == sent);
+	event = pip_take(pip4, &event, SIZE);        ASSERT_timeout(event);
+	event = pip_waitFor(pip4, &event, SIZE, 2);  ASSERT_timeout(event);
+}
+
+void test_pipe_2()
+{
+	TEST_Notify();
+	TEST_Call();
+}
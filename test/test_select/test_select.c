@@ -0,0 +1,10 @@
+#include "test.h"
+
+void test_select()
+{
+	UNIT_Notify();
+	TEST_Add(test_select_1);
+#ifndef __CSMC__
+	TEST_Add(test_select_2);
+#endif
+}
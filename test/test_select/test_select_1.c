@@ -0,0 +1,48 @@
+#include "test.h"
+
+static_SEM(sem3, 0);
+static_BOX(box3, 1, sizeof(unsigned));
+static_FLG(flg3);
+
+static unsigned sent;
+
+static void proc()
+{
+	sel_t sel[] = { SEL_SEM(sem3), SEL_BOX(box3), SEL_FLG(flg3, 2) };
+	unsigned received;
+	unsigned event;
+
+	event = sel_wait(sel, 3);                    ASSERT(event == 1);
+	event = box_take(box3, &received);           ASSERT_success(event);
+	                                             ASSERT(received == sent);
+	event = sel_wait(sel, 3);                    ASSERT(event == 2);
+	event = flg_take(flg3, 2, flgAll);           ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void test()
+{
+	sel_t sel[] = { SEL_SEM(sem3), SEL_BOX(box3), SEL_FLG(flg3, 2) };
+	unsigned event;
+
+	event = sel_take(sel, 3);                    ASSERT_timeout(event);
+	event = sel_waitFor(sel, 3, 1);              ASSERT_timeout(event);
+	        flg_give(flg3, 1);
+	event = sel_take(sel, 3);                    ASSERT_timeout(event);
+	        flg_clear(flg3, 1);
+		                                         ASSERT_dead(tsk1);
+	        tsk_startFrom(tsk1, proc);
+	        sent = rand();
+	event = box_give(box3, &sent);               ASSERT_success(event);
+	        flg_give(flg3, 2);                   ASSERT_dead(tsk1);
+	event = sem_give(sem3);                      ASSERT_success(event);
+	event = sel_take(sel, 3);                    ASSERT(event == 0);
+	event = sem_take(sem3);                      ASSERT_success(event);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+}
+
+void test_select_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
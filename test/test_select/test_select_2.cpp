@@ -0,0 +1,42 @@
+#include "test.h"
+
+static_SEM(sem3, 0);
+static_EVQ(evq3, 1);
+
+static void proc()
+{
+	unsigned received;
+	unsigned event;
+
+	event = Select::wait({ sem3, evq3 });        ASSERT(event == 1);
+	event = evq_take(evq3, &received);           ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+
+	event = Select::take({ sem3, evq3 });        ASSERT_timeout(event);
+	event = Select::waitFor({ sem3, evq3 }, 1);  ASSERT_timeout(event);
+	event = Select::waitUntil({ sem3, evq3 }, sys_time() + 1); ASSERT_timeout(event);
+		                                         ASSERT_dead(tsk1);
+	        tsk_startFrom(tsk1, proc);           ASSERT(tsk1->guard == &System.sel);
+		                                         ASSERT_dead(tsk2);
+	        tsk_startFrom(tsk2, proc);           ASSERT(tsk2->guard == &System.sel);
+	// both tasks are released, the event is taken by the task of higher priority
+	event = evq_give(evq3, 1);                   ASSERT_success(event);
+	                                             ASSERT_dead(tsk2);
+	                                             ASSERT(tsk1->guard == &System.sel);
+	event = evq_give(evq3, 2);                   ASSERT_success(event);
+	                                             ASSERT_dead(tsk1);
+	event = tsk_join(tsk2);                      ASSERT_success(event);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+}
+
+extern "C"
+void test_select_2()
+{
+	TEST_Notify();
+	TEST_Call();
+}
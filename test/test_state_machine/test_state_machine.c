@@ -0,0 +1,10 @@
+#include "test.h"
+
+void test_state_machine()
+{
+	UNIT_Notify();
+#ifndef __CSMC__
+	TEST_Add(test_state_machine_1);
+	TEST_Add(test_state_machine_2);
+#endif
+}
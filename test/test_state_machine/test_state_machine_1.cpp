@@ -0,0 +1,90 @@
+#include "test.h"
+
+enum { S0, S1, S11, S12, S2, STATES };
+enum { SIG_A, SIG_B, SIG_C, SIG_D, SIG_E, SIG_G, SIGNALS };
+
+struct Context
+{
+	char     trace[32];
+	unsigned length;
+	unsigned count;
+
+	void log( char c, unsigned s ) { trace[length++] = c; trace[length++] = char('0' + s); trace[length] = 0; }
+	bool is ( const char *s )      { bool result = strcmp(trace, s) == 0; length = 0; trace[0] = 0; return result; }
+};
+
+template<unsigned s> static void enter( Context &ctx ) { ctx.log('+', s); }
+template<unsigned s> static void leave( Context &ctx ) { ctx.log('-', s); }
+
+static void count( Context &ctx, const aev_t * ) { ctx.count++; }
+static bool never( Context &,     const aev_t * ) { return false; }
+
+static constexpr HsmState<Context> states[] =
+{
+	{ hsmNone, S1,      enter<S0>,  leave<S0>  },
+	{ S0,      S11,     enter<S1>,  leave<S1>  },
+	{ S1,      hsmNone, enter<S11>, leave<S11> },
+	{ S1,      hsmNone, enter<S12>, leave<S12> },
+	{ S0,      hsmNone, enter<S2>,  leave<S2>  },
+};
+
+static constexpr HsmTransition<Context> transitions[] =
+{
+	{ S11, SIG_A, S12 },
+	{ S1,  SIG_B, S2  },
+	{ S2,  SIG_C, S1  },
+	{ S0,  SIG_D, hsmNone, count },
+	{ S1,  SIG_E, S1  },
+	{ S11, SIG_G, S2,  nullptr, never },
+	{ S1,  SIG_G, S12, count },
+};
+
+static constexpr auto table = HsmTable<SIGNALS>(states, transitions, S0);
+
+static Context ctx;
+static EventQueueT<4> evq;
+
+static void test()
+{
+	StateMachineT<decltype(table)> hsm(table, ctx);
+	unsigned event;
+
+	        ctx.length = 0; ctx.count = 0;
+	        hsm.start();                         ASSERT(ctx.is("+0+1+2"));
+	                                             ASSERT(hsm.state() == S11);
+	        hsm.dispatch(SIG_A);                 ASSERT(ctx.is("-2+3"));
+	                                             ASSERT(hsm.state() == S12);
+	// transition inherited from the superstate
+	event = evq.give(SIG_B);                     ASSERT_success(event);
+	event = hsm.take(evq);                       ASSERT_success(event);
+	                                             ASSERT(ctx.is("-3-1+4"));
+	                                             ASSERT(hsm.state() == S2);
+	                                             ASSERT(hsm.isIn(S0) && !hsm.isIn(S1));
+	// signal not handled in the current state
+	        hsm.dispatch(SIG_B);                 ASSERT(ctx.is(""));
+	                                             ASSERT(hsm.state() == S2);
+	// internal transition
+	        hsm.dispatch(SIG_D);                 ASSERT(ctx.is(""));
+	                                             ASSERT(ctx.count == 1);
+	// transition to the composite state enters its initial substate
+	        hsm.dispatch(SIG_C);                 ASSERT(ctx.is("-4+1+2"));
+	                                             ASSERT(hsm.state() == S11);
+	// guard condition is false, the transition of the superstate is taken
+	event = evq.give(SIG_G);                     ASSERT_success(event);
+	event = hsm.waitFor(evq, 1);                 ASSERT_success(event);
+	                                             ASSERT(ctx.is("-2+3"));
+	                                             ASSERT(ctx.count == 2);
+	                                             ASSERT(hsm.state() == S12);
+	// self-transition
+	        hsm.dispatch(SIG_E);                 ASSERT(ctx.is("-3-1+1+2"));
+	                                             ASSERT(hsm.state() == S11);
+	event = hsm.take(evq);                       ASSERT_timeout(event);
+	        hsm.dispatch(SIGNALS);               ASSERT(ctx.is(""));
+}
+
+extern "C"
+void test_state_machine_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,70 @@
+#include "test.h"
+
+enum { BLINKY, OFF, ON, STATES };
+enum { SIG_TOGGLE, SIG_TICK, SIGNALS };
+
+struct Context
+{
+	unsigned on;
+	unsigned ticks;
+};
+
+static void enter_on( Context &ctx )                  { ctx.on++; }
+static void on_tick ( Context &ctx, const aev_t *aev ) { ctx.ticks += aev->signal; }
+
+static constexpr HsmState<Context> states[] =
+{
+	{ hsmNone, OFF },
+	{ BLINKY },
+	{ BLINKY,  hsmNone, enter_on },
+};
+
+static constexpr HsmTransition<Context> transitions[] =
+{
+	{ OFF,    SIG_TOGGLE, ON  },
+	{ ON,     SIG_TOGGLE, OFF },
+	{ BLINKY, SIG_TICK,   hsmNone, on_tick },
+};
+
+static constexpr auto table = HsmTable<SIGNALS>(states, transitions, BLINKY);
+
+static const ActiveEvent toggle(SIG_TOGGLE);
+static const ActiveEvent tick(SIG_TICK);
+
+static Context ctx;
+static ActiveStateMachineT<decltype(table), 2> hsm(table, ctx);
+
+static void proc()
+{
+	if (hsm.wait() != E_SUCCESS)
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+
+	        ctx.on = ctx.ticks = 0;
+	if (hsm.state() == hsmNone)
+	        hsm.start();
+	                                             ASSERT(hsm.state() == OFF);
+	                                             ASSERT_dead(tsk2);
+	        tsk_startFrom(tsk2, proc);           ASSERT_ready(tsk2);
+	// events are dispatched to completion by the task of higher priority
+	event = hsm.post(&toggle);                   ASSERT_success(event);
+	                                             ASSERT(hsm.state() == ON && ctx.on == 1);
+	event = hsm.post(&tick);                     ASSERT_success(event);
+	                                             ASSERT(hsm.state() == ON && ctx.ticks == SIG_TICK);
+	event = hsm.post(&toggle);                   ASSERT_success(event);
+	                                             ASSERT(hsm.state() == OFF && ctx.on == 1);
+	event = hsm.take();                          ASSERT_timeout(event);
+	        hsm.reset();
+	event = tsk_join(tsk2);                      ASSERT_success(event);
+}
+
+extern "C"
+void test_state_machine_2()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -8,4 +8,5 @@ void test_stream_buffer()
 	TEST_Add(test_stream_buffer_2);
 	TEST_Add(test_stream_buffer_3);
 #endif
+	TEST_Add(test_stream_buffer_4);
 }
@@ -0,0 +1,54 @@
+#include "test.h"
+
+#define SIZE sizeof(unsigned)
+
+static_STM(stm3, 3, SIZE);
+
+static unsigned sent;
+
+static void proc1()
+{
+	unsigned bytes;
+	unsigned event;
+
+ 	bytes = stm_wait(stm3, &event, SIZE);        ASSERT(bytes == SIZE);
+	                                             ASSERT(event == sent);
+	event = stm_send(stm3, &sent, SIZE);         ASSERT_success(event);
+	event = stm_send(stm3, &sent, SIZE);         ASSERT_success(event);
+	event = stm_send(stm3, &sent, SIZE);         ASSERT_success(event);
+	event = stm_send(stm3, &sent, SIZE);         ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned bytes;
+	unsigned event;
+	void   * data;
+		                                         ASSERT_dead(tsk1);
+	        tsk_startFrom(tsk1, proc1);          ASSERT_ready(tsk1);
+	        sent = rand();
+	bytes = stm_reserve(stm3, &data, SIZE);      ASSERT(bytes == SIZE);
+	        memcpy(data, &sent, SIZE);
+	event = stm_commit(stm3, SIZE);              ASSERT_success(event);
+	bytes = stm_peek(stm3, &data);               ASSERT(bytes == 2 * SIZE);
+	        memcpy(&event, data, SIZE);          ASSERT(event == sent);
+	event = stm_reserve(stm3, &data, SIZE);      ASSERT_timeout(event);
+	event = stm_consume(stm3, SIZE);             ASSERT_success(event);
+	bytes = stm_peek(stm3, &data);               ASSERT(bytes == SIZE);
+	event = stm_consume(stm3, 3 * SIZE);         ASSERT_success(event);
+	event = stm_consume(stm3, SIZE);             ASSERT_failure(event);
+	event = stm_peek(stm3, &data);               ASSERT_timeout(event);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+	bytes = stm_reserve(stm3, &data, 4 * SIZE);  ASSERT(bytes == 3 * SIZE);
+	event = stm_commit(stm3, 4 * SIZE);          ASSERT_failure(event);
+	event = stm_commit(stm3, 3 * SIZE);          ASSERT_success(event);
+	event = stm_reserve(stm3, &data, SIZE);      ASSERT_timeout(event);
+	event = stm_consume(stm3, 3 * SIZE);         ASSERT_success(event);
+}
+
+void test_stream_buffer_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
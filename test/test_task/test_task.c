@@ -9,11 +9,16 @@ void test_task()
 	TEST_Add(test_task_create_3);
 	TEST_Add(test_task_infinite_loop_1);
 	TEST_Add(test_task_signal_1);
+	TEST_Add(test_task_sched_lock_1);
+#if OS_TASK_STATS
+	TEST_Add(test_task_run_time_1);
+#endif
 #ifndef __CSMC__
 	TEST_Add(test_task_infinite_loop_2);
 	TEST_Add(test_task_infinite_loop_3);
 	TEST_Add(test_task_signal_2);
 	TEST_Add(test_task_signal_3);
+	TEST_Add(test_task_sched_lock_2);
 	TEST_Add(test_task_create_4);
 	TEST_Add(test_task_create_5);
 	TEST_Add(test_task_create_6);
@@ -0,0 +1,34 @@
+#include "test.h"
+
+static void proc()
+{
+	cnt_t   time;
+	        time = sys_time();
+	        while (sys_time() == time);          // wait for the beginning of the next tick
+	        time = sys_time();
+	        while (sys_time() == time);          // keep the processor busy for the whole tick
+	        tsk_stop();
+}
+
+static void test()
+{
+	uint64_t time;
+	unsigned event;
+	unsigned load;
+	        sys_getLoad();
+	time  = tsk_getRunTime(tsk1);                ASSERT_dead(tsk1);
+	        tsk_startFrom(tsk1, proc);           ASSERT_dead(tsk1);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+	time  = tsk_getRunTime(tsk1) - time;         ASSERT(time >= (CYC_FREQUENCY)/(OS_FREQUENCY)/2);
+	load  = sys_getLoad();                       ASSERT(load >= 50);
+	time  = tsk_getRunTime(&IDLE);
+	        tsk_delay(2);
+	time  = tsk_getRunTime(&IDLE) - time;        ASSERT(time > 0);
+	load  = sys_getLoad();                       ASSERT(load < 100);
+}
+
+void test_task_run_time_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,37 @@
+#include "test.h"
+
+static volatile
+unsigned counter;
+
+static void proc()
+{
+	        counter++;
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+	cnt_t    time;
+	counter = 0;
+	        sys_schedLock();
+	        tsk_startFrom(tsk1, proc);           ASSERT_ready(tsk1);
+	        tsk_startFrom(tsk2, proc);           ASSERT_ready(tsk2);
+	        sys_schedLock();
+	time  = sys_time();
+	        while (sys_time() == time);          // interrupts are not disabled by the scheduler lock
+	        sys_schedUnlock();                   ASSERT(counter == 0);
+	                                             ASSERT_ready(tsk1);
+	                                             ASSERT_ready(tsk2);
+	        sys_schedUnlock();                   ASSERT(counter == 2);
+	                                             ASSERT_dead(tsk1);
+	                                             ASSERT_dead(tsk2);
+	event = tsk_join(tsk2);                      ASSERT_success(event);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+}
+
+void test_task_sched_lock_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
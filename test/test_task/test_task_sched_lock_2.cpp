@@ -0,0 +1,32 @@
+#include "test.h"
+
+static volatile
+unsigned counter;
+
+static void proc()
+{
+	        counter++;
+	        ThisTask::stop();
+}
+
+static void test()
+{
+	unsigned event;
+	counter = 0;
+	{
+		SchedulerLock lock;
+	        Tsk2.startFrom(proc);                ASSERT(!!Tsk2);
+	        Tsk3.startFrom(proc);                ASSERT(!!Tsk3);
+	        ThisTask::yield();                   ASSERT(counter == 0);
+	}
+	                                             ASSERT(counter == 2);
+	event = Tsk3.join();                         ASSERT_success(event);
+	event = Tsk2.join();                         ASSERT_success(event);
+}
+
+extern "C"
+void test_task_sched_lock_2()
+{
+	TEST_Notify();
+	TEST_Call();
+}
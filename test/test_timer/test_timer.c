@@ -7,5 +7,15 @@ void test_timer()
 #ifndef __CSMC__
 	TEST_Add(test_timer_2);
 	TEST_Add(test_timer_3);
+#endif
+	TEST_Add(test_timer_4);
+#if OS_TIMER_TASK
+	TEST_Add(test_timer_5);
+#endif
+#if HW_TIMER_SIZE == 0
+	TEST_Add(test_timer_6);
+#endif
+#if OS_TIMER_WHEEL
+	TEST_Add(test_timer_7);
 #endif
 }
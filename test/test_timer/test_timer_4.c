@@ -0,0 +1,45 @@
+#include "test.h"
+
+static tmr_t tmr[8];
+
+static cnt_t expired;
+static int   counter;
+
+static void proc()
+{
+	tmr_t *cur = tmr_thisISR();
+	                                             ASSERT((cnt_t)(cur->start - expired) <= CNT_LIMIT);
+	        expired = cur->start;
+	        counter++;
+}
+
+static void test()
+{
+	unsigned event;
+
+	        counter = 0;
+	        expired = sys_time();
+	        tmr_startFrom(&tmr[0], 5, 0, proc);
+	        tmr_startFrom(&tmr[1], 1, 0, proc);
+	        tmr_startFrom(&tmr[2], 9, 0, proc);
+	        tmr_startFrom(&tmr[3], 3, 0, proc);
+	        tmr_startFrom(&tmr[4], 0, 0, proc);
+	        tmr_startFrom(&tmr[5], 7, 0, proc);
+	        tmr_startFrom(&tmr[6], 2, 0, proc);
+	        tmr_startFrom(&tmr[7], 8, 0, proc);
+	event = tmr_wait(&tmr[0]);                   ASSERT_success(event);
+	event = tmr_wait(&tmr[1]);                   ASSERT_success(event);
+	event = tmr_wait(&tmr[2]);                   ASSERT_success(event);
+	event = tmr_wait(&tmr[3]);                   ASSERT_success(event);
+	event = tmr_wait(&tmr[4]);                   ASSERT_success(event);
+	event = tmr_wait(&tmr[5]);                   ASSERT_success(event);
+	event = tmr_wait(&tmr[6]);                   ASSERT_success(event);
+	event = tmr_wait(&tmr[7]);                   ASSERT_success(event);
+	                                             ASSERT(counter == 8);
+}
+
+void test_timer_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,57 @@
+#include "test.h"
+
+#if OS_TIMER_TASK
+
+static tsk_t * task;
+static tmr_t * self;
+static int     counter;
+
+static void proc1()
+{
+	        task = tsk_this();
+	        self = tmr_thisISR();
+	        counter++;
+}
+
+static void proc2()
+{
+	if (++counter == 3)
+	        tmr_reset(tmr_thisISR());            // the timer task may use thread mode functions
+}
+
+static void proc3()
+{
+	        counter++;
+	        tmr_delayISR(0);
+}
+
+static void test()
+{
+	unsigned event;
+
+	        counter = 0;
+	        tmr_startFrom(tmr1, 1, 0, proc1);
+	event = tmr_wait(tmr1);                      ASSERT_success(event);
+	                                             ASSERT(counter == 1);
+	                                             ASSERT(task == &TIMER);
+	                                             ASSERT(self == tmr1);
+	                                             ASSERT_dead(tmr1);
+	        counter = 0;
+	        tmr_startFrom(tmr1, 1, 1, proc2);
+	        do tmr_wait(tmr1); while (counter < 3);
+	                                             ASSERT(counter == 3);
+	                                             ASSERT_dead(tmr1);
+	        counter = 0;
+	        tmr_startFrom(tmr1, 1, 1, proc3);
+	event = tmr_wait(tmr1);                      ASSERT_success(event);
+	                                             ASSERT(counter == 1);
+	                                             ASSERT_dead(tmr1);
+}
+
+void test_timer_5()
+{
+	TEST_Notify();
+	TEST_Call();
+}
+
+#endif
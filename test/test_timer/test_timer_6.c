@@ -0,0 +1,61 @@
+#include "test.h"
+
+#if HW_TIMER_SIZE == 0
+
+static tmr_t tmr[2];
+
+static int   counter;
+
+static void proc()
+{
+	if (++counter >= 3)
+	        tmr_delayISR(0);
+}
+
+// check whether another object of the timers queue expires together with the timer
+static bool together( tmr_t *cur )
+{
+	tmr_t *nxt;
+	bool   result = false;
+
+	sys_lock();
+	{
+		for (nxt = core_tmr_next(&WAIT); nxt != &WAIT; nxt = core_tmr_next(nxt))
+			if (nxt != cur && nxt->delay != INFINITE && nxt->start + nxt->delay == cur->start + cur->delay)
+				result = true;
+	}
+	sys_unlock();
+
+	return result;
+}
+
+static void test()
+{
+	unsigned event;
+	cnt_t    start;
+
+	        tmr_startFor(&tmr[0], 6);
+	        tmr_startSlack(&tmr[1], 4, 0, 3);    ASSERT(tmr[1].shift <= 3);
+	                                             ASSERT(together(&tmr[1]));
+	        start = tmr[1].start;
+	event = tmr_wait(&tmr[1]);                   ASSERT_success(event);
+	                                             ASSERT((cnt_t)(sys_time() - start) >= 4);
+	event = tmr_wait(&tmr[0]);                   ASSERT_success(event);
+	        tmr_startSlack(&tmr[1], 2, 0, 0);    ASSERT(tmr[1].shift == 0);
+	event = tmr_wait(&tmr[1]);                   ASSERT_success(event);
+	        counter = 0;
+	        tmr_init(&tmr[1], proc);
+	        tmr_startSlack(&tmr[1], 4, 4, 2);
+	        start = tmr[1].start;
+	        do tmr_wait(&tmr[1]); while (counter < 3);
+	                                             ASSERT(counter == 3);
+	                                             ASSERT(tmr[1].start - start == 12);
+}
+
+void test_timer_6()
+{
+	TEST_Notify();
+	TEST_Call();
+}
+
+#endif
@@ -0,0 +1,50 @@
+#include "test.h"
+
+#if OS_TIMER_WHEEL
+
+#define TIMERS 16
+
+static tmr_t tmr[TIMERS];
+static tmr_t lng;
+
+static cnt_t expired;
+static int   counter;
+
+static void proc()
+{
+	tmr_t *cur = tmr_thisISR();
+	                                             ASSERT((cnt_t)(cur->start - expired) <= CNT_LIMIT);
+	        expired = cur->start;
+	        counter++;
+}
+
+// timers hung in the higher levels of the timing wheel expire in order, also in a burst of the same expiration
+static void test()
+{
+	unsigned event;
+	unsigned i;
+
+	        counter = 0;
+	        expired = sys_time();
+	        tmr_init(&lng, NULL);
+	        tmr_startFor(&lng, SEC + 100 * OS_TIMER_SLOT * OS_TIMER_WHEEL);
+	for (i = 0; i < TIMERS; i++)
+	{
+	        tmr_startFrom(&tmr[i], i < TIMERS / 2 ? 10 : (cnt_t)rand() % 12, 0, proc);
+	}
+	for (i = 0; i < TIMERS; i++)
+	{
+	event = tmr_wait(&tmr[i]);                   ASSERT_success(event);
+	}
+	                                             ASSERT(counter == TIMERS);
+	                                             ASSERT(lng.hdr.id == ID_TIMER);
+	        tmr_reset(&lng);                     ASSERT(lng.hdr.id == ID_STOPPED);
+}
+
+void test_timer_7()
+{
+	TEST_Notify();
+	TEST_Call();
+}
+
+#endif
@@ -0,0 +1,11 @@
+#include "test.h"
+
+void test_trace()
+{
+	UNIT_Notify();
+#if OS_TRACE_SIZE
+	TEST_Add(test_trace_1);
+	TEST_Add(test_trace_2);
+	TEST_Add(test_trace_3);
+#endif
+}
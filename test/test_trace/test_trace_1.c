@@ -0,0 +1,54 @@
+#include "test.h"
+
+#if OS_TRACE_SIZE
+
+static trc_t    table[32];
+static unsigned count;
+static unsigned pos;
+
+static const trc_t *next()                       // next record concerning the task tsk1
+{
+	static const trc_t none = { 0 };
+	const trc_t *trc;
+	while (pos < count)
+	{
+		trc = &table[pos++];
+		if (trc->obj == tsk1 || (trc->type == trcSwitch && trc->arg == (uintptr_t)tsk1))
+			return trc;
+	}
+	return &none;
+}
+
+static void proc()
+{
+	unsigned event;
+	event = sem_wait(sem1);                      ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void test()
+{
+	const trc_t *trc;
+	unsigned event;
+	        while (sys_traceRead(table, 32));    // discard records of the previous tests
+	        tsk_startFrom(tsk1, proc);           ASSERT_ready(tsk1);
+	event = sem_give(sem1);                      ASSERT_success(event);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+	count = sys_traceRead(table, 32);            ASSERT(count >= 6);
+	pos = 0;
+	trc = next();                                ASSERT(trc->type == trcSwitch && trc->obj == tsk1);
+	trc = next();                                ASSERT(trc->type == trcWait   && trc->arg == (uintptr_t)&sem1->obj.queue);
+	trc = next();                                ASSERT(trc->type == trcSwitch && trc->arg == (uintptr_t)tsk1);
+	trc = next();                                ASSERT(trc->type == trcWakeup && trc->arg == E_SUCCESS);
+	trc = next();                                ASSERT(trc->type == trcSwitch && trc->obj == tsk1);
+	trc = next();                                ASSERT(trc->type == trcSwitch && trc->arg == (uintptr_t)tsk1);
+	trc = next();                                ASSERT(trc->type == 0);
+}
+
+void test_trace_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
+
+#endif
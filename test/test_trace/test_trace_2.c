@@ -0,0 +1,44 @@
+#include "test.h"
+
+#if OS_TRACE_SIZE
+
+static trc_t    table[32];
+static unsigned count;
+static unsigned pos;
+
+static const trc_t *next( const void *obj1, const void *obj2 ) // next record (except context switches) concerning the given objects
+{
+	static const trc_t none = { 0 };
+	const trc_t *trc;
+	while (pos < count)
+	{
+		trc = &table[pos++];
+		if (trc->type != trcSwitch && (trc->obj == obj1 || trc->obj == obj2))
+			return trc;
+	}
+	return &none;
+}
+
+static void test()
+{
+	const trc_t *trc;
+	tsk_t *cur = tsk_this();
+	unsigned event;
+	        while (sys_traceRead(table, 32));    // discard records of the previous tests
+	        tmr_startFor(tmr1, MSEC);
+	event = tmr_wait(tmr1);                      ASSERT_success(event);
+	count = sys_traceRead(table, 32);            ASSERT(count >= 3);
+	pos = 0;
+	trc = next(cur, tmr1);                       ASSERT(trc->type == trcWait   && trc->obj == cur  && trc->arg == (uintptr_t)&tmr1->hdr.obj.queue);
+	trc = next(cur, tmr1);                       ASSERT(trc->type == trcTimer  && trc->obj == tmr1 && trc->arg == E_SUCCESS);
+	trc = next(cur, tmr1);                       ASSERT(trc->type == trcWakeup && trc->obj == cur  && trc->arg == E_SUCCESS);
+	trc = next(cur, tmr1);                       ASSERT(trc->type == 0);
+}
+
+void test_trace_2()
+{
+	TEST_Notify();
+	TEST_Call();
+}
+
+#endif
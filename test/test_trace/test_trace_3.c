@@ -0,0 +1,48 @@
+#include "test.h"
+
+#if OS_TRACE_SIZE
+
+static trc_t    table[32];
+static unsigned count;
+static unsigned pos;
+
+static const trc_t *next( const void *obj1, const void *obj2 ) // next record (except context switches) concerning the given objects
+{
+	static const trc_t none = { 0 };
+	const trc_t *trc;
+	while (pos < count)
+	{
+		trc = &table[pos++];
+		if (trc->type != trcSwitch && (trc->obj == obj1 || trc->obj == obj2))
+			return trc;
+	}
+	return &none;
+}
+
+static void test()
+{
+	const trc_t *trc;
+	tsk_t *cur = tsk_this();
+	unsigned event;
+	        while (sys_traceRead(table, 32));    // discard records of the previous tests
+	event = sem_give(sem1);                      ASSERT_success(event);
+	event = sem_take(sem1);                      ASSERT_success(event);
+	event = sem_take(sem1);                      ASSERT_timeout(event);
+	event = mtx_take(mtx1);                      ASSERT_success(event);
+	event = mtx_give(mtx1);                      ASSERT_success(event);
+	count = sys_traceRead(table, 32);            ASSERT(count >= 4);
+	pos = 0;
+	trc = next(sem1, mtx1);                      ASSERT(trc->type == trcGive && trc->obj == sem1 && trc->arg == (uintptr_t)cur);
+	trc = next(sem1, mtx1);                      ASSERT(trc->type == trcTake && trc->obj == sem1 && trc->arg == (uintptr_t)cur);
+	trc = next(sem1, mtx1);                      ASSERT(trc->type == trcTake && trc->obj == mtx1 && trc->arg == (uintptr_t)cur);
+	trc = next(sem1, mtx1);                      ASSERT(trc->type == trcGive && trc->obj == mtx1 && trc->arg == (uintptr_t)cur);
+	trc = next(sem1, mtx1);                      ASSERT(trc->type == 0);
+}
+
+void test_trace_3()
+{
+	TEST_Notify();
+	TEST_Call();
+}
+
+#endif